@@ -1,10 +1,17 @@
 #ifndef COLLECTIONS_GENERIC_H
 #define COLLECTIONS_GENERIC_H
 
+#include "src/concurrent_hash_table/concurrent_hash_table.h"
+#include "src/read_mostly_hash_table/read_mostly_hash_table.h"
+#include "src/bloom_filter/bloom_filter.h"
+#include "src/hash_set/hash_set.h"
 #include "src/hash_table/hash_table.h"
+#include "src/ordered_hash_table/ordered_hash_table.h"
 #include "src/linked_list/linked_list.h"
+#include "src/multi_map/multi_map.h"
 #include "src/queue/queue.h"
 #include "src/stack/stack.h"
 #include "src/sorted_list/sorted_list.h"
+#include "src/typed_hash_table/typed_hash_table.h"
 
 #endif
\ No newline at end of file
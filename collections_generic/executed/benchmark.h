@@ -0,0 +1,33 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <time.h>
+
+/**
+ * @brief Returns a monotonic time in seconds, for timing benchmarks.
+ */
+static inline double get_seconds(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Prints the lookup throughput of concurrent_hash_table_t for 1 to 8
+ * reader threads.
+ */
+void benchmark_concurrent_hash_table(void);
+
+/**
+ * @brief Prints the lookup throughput of read_mostly_hash_table_t for 1 to 8
+ * reader threads.
+ */
+void benchmark_read_mostly_hash_table(void);
+
+/**
+ * @brief Prints the lookup throughput of hash_table_t and of a table
+ * declared with DECLARE_HASH_TABLE, for the same int keys.
+ */
+void benchmark_typed_hash_table(void);
+
+#endif
@@ -0,0 +1,50 @@
+#include "../src/concurrent_hash_table/concurrent_hash_table.h"
+#include "benchmark.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+#define MAX_THREAD_COUNT 8
+#define KEY_COUNT 20000
+#define ROUND_COUNT 4
+
+static int compare_int_keys(const int *a, const int *b) { return *a - *b; }
+
+static void *get_all_keys(void *argument) {
+  concurrent_hash_table_t *table = argument;
+  for (int round = 0; round < ROUND_COUNT; round++) {
+    for (int key = 0; key < KEY_COUNT; key++) {
+      int value;
+      get_from_concurrent_hash_table(table, &key, &value);
+    }
+  }
+  return NULL;
+}
+
+void benchmark_concurrent_hash_table(void) {
+  concurrent_hash_table_t *table = create_concurrent_hash_table(
+      0, sizeof(int), NULL, NULL, (compare_t)compare_int_keys, sizeof(int),
+      NULL, NULL, NULL);
+  if (table == NULL)
+    return;
+  for (int key = 0; key < KEY_COUNT; key++)
+    add_to_concurrent_hash_table(table, &key, &key);
+
+  // Every thread does the same work, so the total throughput should grow
+  // with the thread count
+  for (int thread_count = 1; thread_count <= MAX_THREAD_COUNT;
+       thread_count *= 2) {
+    pthread_t threads[MAX_THREAD_COUNT];
+    double start = get_seconds();
+    for (int i = 0; i < thread_count; i++)
+      pthread_create(&threads[i], NULL, get_all_keys, table);
+    for (int i = 0; i < thread_count; i++)
+      pthread_join(threads[i], NULL);
+    double elapsed = get_seconds() - start;
+    printf("concurrent_hash_table: %d reader thread(s), %.1f Mops/s\n",
+           thread_count,
+           thread_count * (double)ROUND_COUNT * KEY_COUNT / elapsed / 1e6);
+  }
+
+  destruct_concurrent_hash_table(table);
+}
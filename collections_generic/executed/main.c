@@ -1,4 +1,5 @@
 #include "../src/hash_table/hash_table.h"
+#include "benchmark.h"
 #include <stdio.h>
 
 
@@ -27,4 +28,8 @@ int main(void) {
 
   // Destroy the hash table
   destruct_hash_table(table);
+
+  benchmark_concurrent_hash_table();
+  benchmark_read_mostly_hash_table();
+  benchmark_typed_hash_table();
 }
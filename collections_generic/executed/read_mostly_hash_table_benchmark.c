@@ -0,0 +1,50 @@
+#include "../src/read_mostly_hash_table/read_mostly_hash_table.h"
+#include "benchmark.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+#define MAX_THREAD_COUNT 8
+#define KEY_COUNT 2000
+#define ROUND_COUNT 20
+
+static int compare_int_keys(const int *a, const int *b) { return *a - *b; }
+
+static void *read_all_keys(void *argument) {
+  read_mostly_hash_table_t *table = argument;
+  for (int round = 0; round < ROUND_COUNT; round++) {
+    for (int key = 0; key < KEY_COUNT; key++) {
+      int value;
+      get_from_read_mostly_hash_table(table, &key, &value);
+    }
+  }
+  return NULL;
+}
+
+void benchmark_read_mostly_hash_table(void) {
+  read_mostly_hash_table_t *table = create_read_mostly_hash_table(
+      sizeof(int), NULL, NULL, (compare_t)compare_int_keys, sizeof(int), NULL,
+      NULL, NULL);
+  if (table == NULL)
+    return;
+  hash_table_t *copy = begin_read_mostly_hash_table_write(table);
+  for (int key = 0; key < KEY_COUNT; key++)
+    add_to_hash_table(copy, &key, &key);
+  commit_read_mostly_hash_table_write(table, copy);
+
+  for (int thread_count = 1; thread_count <= MAX_THREAD_COUNT;
+       thread_count *= 2) {
+    pthread_t threads[MAX_THREAD_COUNT];
+    double start = get_seconds();
+    for (int i = 0; i < thread_count; i++)
+      pthread_create(&threads[i], NULL, read_all_keys, table);
+    for (int i = 0; i < thread_count; i++)
+      pthread_join(threads[i], NULL);
+    double elapsed = get_seconds() - start;
+    printf("read_mostly_hash_table: %d reader thread(s), %.1f Mops/s\n",
+           thread_count,
+           thread_count * (double)ROUND_COUNT * KEY_COUNT / elapsed / 1e6);
+  }
+
+  destruct_read_mostly_hash_table(table);
+}
@@ -0,0 +1,63 @@
+#include "../src/hash_table/hash_table.h"
+#include "../src/typed_hash_table/typed_hash_table.h"
+#include "benchmark.h"
+
+#include <stdio.h>
+
+#define KEY_COUNT (1 << 18)
+#define ROUND_COUNT 8
+
+static inline size_t hash_int(int key) { return (size_t)(unsigned int)key; }
+#define EQUAL_INTS(first, second) ((first) == (second))
+
+DECLARE_HASH_TABLE(int_float_map, int, float, hash_int, EQUAL_INTS);
+
+static int compare_int_keys(const int *a, const int *b) { return *a - *b; }
+
+void benchmark_typed_hash_table(void) {
+  int_float_map_t *map = int_float_map_create();
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_int_keys,
+                        sizeof(float), NULL, NULL, NULL);
+  if (map == NULL || table == NULL) {
+    int_float_map_destruct(map);
+    destruct_hash_table(table);
+    return;
+  }
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key;
+    add_to_hash_table(table, &key, &value);
+    int_float_map_add(map, key, value);
+  }
+
+  // half of the lookups miss; the sums keep the loops from being dropped
+  double sums[2] = {0, 0};
+  double start = get_seconds();
+  for (int round = 0; round < ROUND_COUNT; round++) {
+    for (int key = 0; key < 2 * KEY_COUNT; key++) {
+      float value;
+      if (get_from_hash_table(table, &key, &value))
+        sums[0] += value;
+    }
+  }
+  double generic = get_seconds() - start;
+
+  start = get_seconds();
+  for (int round = 0; round < ROUND_COUNT; round++) {
+    for (int key = 0; key < 2 * KEY_COUNT; key++) {
+      float value;
+      if (int_float_map_get(map, key, &value))
+        sums[1] += value;
+    }
+  }
+  double typed = get_seconds() - start;
+
+  double lookups = 2.0 * KEY_COUNT * ROUND_COUNT / 1e6;
+  printf("hash_table_t: %.1f Mlookups/s, DECLARE_HASH_TABLE: %.1f "
+         "Mlookups/s (checksums %s)\n",
+         lookups / generic, lookups / typed,
+         sums[0] == sums[1] ? "match" : "differ");
+
+  destruct_hash_table(table);
+  int_float_map_destruct(map);
+}
@@ -0,0 +1,7 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include "bloom_filter_functions/base/base_functions.h"
+#include "types/bloom_filter_t.h"
+
+#endif
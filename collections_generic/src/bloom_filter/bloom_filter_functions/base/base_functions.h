@@ -0,0 +1,49 @@
+#ifndef BASE_FUNCTIONS_BLOOM_FILTER_H
+#define BASE_FUNCTIONS_BLOOM_FILTER_H
+
+#include "../../types/bloom_filter_t.h"
+#include "bloom_filter_hash.h"
+
+/**
+ * Creates an empty Bloom filter sized for the expected number of keys.
+ *
+ * @param expected_count number of keys the filter is sized for; more keys
+ * raise the false positive rate
+ * @param false_positive_rate wanted rate of "maybe present" answers for
+ * absent keys, between 0 and 1
+ * @param key_size size of the keys
+ * @param get_hash_code function to get hash codes of keys, the same
+ * callbacks as `hash_table_t::get_hash_code`; NULL hashes the key bytes
+ *
+ * @return a pointer to the newly created filter, or NULL on failure
+ */
+bloom_filter_t *create_bloom_filter(size_t expected_count,
+                                    double false_positive_rate,
+                                    size_t key_size,
+                                    get_hash_code_t get_hash_code);
+
+/**
+ * Deallocates all memory used by the given filter, including the filter
+ * itself.
+ */
+void destruct_bloom_filter(bloom_filter_t *filter);
+
+/**
+ * @brief Removes every key from the filter.
+ */
+void clear_bloom_filter(bloom_filter_t *filter);
+
+/**
+ * @brief Adds a key to the filter.
+ */
+void add_to_bloom_filter(bloom_filter_t *filter, const void *key);
+
+/**
+ * @brief Checks if a key may be in the filter.
+ *
+ * @return False if the key was certainly never added, true if it may have
+ * been.
+ */
+bool_t contains_in_bloom_filter(const bloom_filter_t *filter, const void *key);
+
+#endif
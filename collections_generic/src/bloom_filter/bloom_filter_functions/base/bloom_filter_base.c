@@ -0,0 +1,27 @@
+#include "../../../hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../../support/validators.h"
+#include "base_functions.h"
+
+static size_t get_bloom_filter_hash(const bloom_filter_t *filter,
+                                    const void *key) {
+  return get_seeded_key_hash_code(filter->get_hash_code, filter->hash_seed,
+                                  filter->key_size, key);
+}
+
+void add_to_bloom_filter(bloom_filter_t *filter, const void *key) {
+  if (NULL_ARGUMENT_CHECK(filter) || NULL_ARGUMENT_CHECK(key)) {
+    return;
+  }
+
+  add_hash_to_bloom_filter(filter, get_bloom_filter_hash(filter, key));
+}
+
+bool_t contains_in_bloom_filter(const bloom_filter_t *filter,
+                                const void *key) {
+  if (NULL_ARGUMENT_CHECK(filter) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  return contains_hash_in_bloom_filter(filter,
+                                       get_bloom_filter_hash(filter, key));
+}
@@ -0,0 +1,73 @@
+#include "../../../hash_table/hash_table_functions/common/hash.h"
+#include "../../../support/error.h"
+#include "../../../support/validators.h"
+#include "base_functions.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BLOOM_FILTER_LN2 0.69314718055994530942
+
+bloom_filter_t *create_bloom_filter(size_t expected_count,
+                                    double false_positive_rate,
+                                    size_t key_size,
+                                    get_hash_code_t get_hash_code) {
+  if (false_positive_rate <= 0 || false_positive_rate >= 1) {
+    ERROR_MESSAGE("The false positive rate must be between 0 and 1.");
+    return NULL;
+  }
+
+  bloom_filter_t *filter = calloc(1, sizeof(bloom_filter_t));
+  if (MALLOC_FAILURE_CHECK(filter)) {
+    return NULL;
+  }
+
+  // m = -n ln(p) / ln(2)^2 bits, rounded up to a power of two of blocks
+  if (expected_count == 0)
+    expected_count = 1;
+  double bits_per_key = -log(false_positive_rate) / (BLOOM_FILTER_LN2 * BLOOM_FILTER_LN2);
+  double bits = bits_per_key * (double)expected_count;
+  filter->block_count = 1;
+  while ((double)(filter->block_count * BLOOM_FILTER_BLOCK_BITS) < bits)
+    filter->block_count *= 2;
+
+  // k = m / n ln(2), for the bits actually allocated
+  double actual_bits_per_key =
+      (double)(filter->block_count * BLOOM_FILTER_BLOCK_BITS) /
+      (double)expected_count;
+  filter->hash_count = (size_t)(actual_bits_per_key * BLOOM_FILTER_LN2 + 0.5);
+  if (filter->hash_count < 1)
+    filter->hash_count = 1;
+  if (filter->hash_count > BLOOM_FILTER_MAX_HASH_COUNT)
+    filter->hash_count = BLOOM_FILTER_MAX_HASH_COUNT;
+
+  filter->blocks =
+      calloc(filter->block_count * BLOOM_FILTER_BLOCK_WORDS, sizeof(uint64_t));
+  if (MALLOC_FAILURE_CHECK(filter->blocks)) {
+    free(filter);
+    return NULL;
+  }
+  filter->key_size = key_size;
+  filter->get_hash_code = get_hash_code;
+  filter->hash_seed = (size_t)generate_hash_seed();
+  return filter;
+}
+
+void destruct_bloom_filter(bloom_filter_t *filter) {
+  if (filter == NULL)
+    return;
+
+  free(filter->blocks);
+  free(filter);
+}
+
+void clear_bloom_filter(bloom_filter_t *filter) {
+  if (NULL_ARGUMENT_CHECK(filter)) {
+    return;
+  }
+
+  memset(filter->blocks, 0,
+         filter->block_count * BLOOM_FILTER_BLOCK_WORDS * sizeof(uint64_t));
+  filter->count = 0;
+}
@@ -0,0 +1,57 @@
+#ifndef BLOOM_FILTER_HASH_H
+#define BLOOM_FILTER_HASH_H
+
+#include "../../../hash_table/hash_table_functions/common/hash.h"
+#include "../../types/bloom_filter_t.h"
+
+/**
+ * @brief Returns the first word of the block of a hash code, and the first
+ * bit and the bit step of its probes in `bit` and `step`.
+ */
+static inline uint64_t *get_bloom_filter_block(const bloom_filter_t *filter,
+                                               size_t hash, uint32_t *bit,
+                                               uint32_t *step) {
+  // a mixed hash, so the block does not follow the bits of the caller
+  uint64_t mixed = mix_hash_code(hash);
+  size_t block = (size_t)(mixed >> 32) & (filter->block_count - 1);
+  *bit = (uint32_t)mixed;
+  *step = (uint32_t)(mixed >> 23) | 1;
+  return filter->blocks + block * BLOOM_FILTER_BLOCK_WORDS;
+}
+
+/**
+ * @brief Adds a key to the filter given its full-width hash code.
+ *
+ * @details Used by tables that already have the hash code of a key, such as
+ * `hash_table_t` with the stored hashes of its slots.
+ */
+static inline void add_hash_to_bloom_filter(bloom_filter_t *filter,
+                                            size_t hash) {
+  uint32_t bit, step;
+  uint64_t *block = get_bloom_filter_block(filter, hash, &bit, &step);
+  for (size_t i = 0; i < filter->hash_count; i++, bit += step) {
+    uint32_t position = bit % BLOOM_FILTER_BLOCK_BITS;
+    block[position / 64] |= (uint64_t)1 << (position % 64);
+  }
+  filter->count++;
+}
+
+/**
+ * @brief Checks a key given its full-width hash code.
+ *
+ * @return False if no key with that hash was added, true if one may have
+ * been.
+ */
+static inline bool_t contains_hash_in_bloom_filter(const bloom_filter_t *filter,
+                                                   size_t hash) {
+  uint32_t bit, step;
+  const uint64_t *block = get_bloom_filter_block(filter, hash, &bit, &step);
+  for (size_t i = 0; i < filter->hash_count; i++, bit += step) {
+    uint32_t position = bit % BLOOM_FILTER_BLOCK_BITS;
+    if ((block[position / 64] & ((uint64_t)1 << (position % 64))) == 0)
+      return false;
+  }
+  return true;
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef BLOOM_FILTER_T_H
+#define BLOOM_FILTER_T_H
+
+#include <stdint.h>
+
+#include "../../types/functions.h"
+
+/**
+ * @brief Number of 64-bit words of a block, so that a block fills one
+ * 64-byte cache line.
+ */
+#define BLOOM_FILTER_BLOCK_WORDS 8
+#define BLOOM_FILTER_BLOCK_BITS (BLOOM_FILTER_BLOCK_WORDS * 64)
+
+/**
+ * @brief Largest number of bits set per key.
+ */
+#define BLOOM_FILTER_MAX_HASH_COUNT 16
+
+/**
+ * @brief A blocked Bloom filter.
+ *
+ * @details A set of key hashes that answers "maybe present" or "certainly
+ * absent". All the bits of a key lie in one cache-line block chosen by its
+ * hash, so a query costs one cache miss however many bits it tests. Keys
+ * cannot be removed; a filter with many removed keys has to be cleared and
+ * refilled.
+ *
+ * @param block_count Number of blocks, a power of two.
+ * @param hash_count Number of bits set per key.
+ * @param count Number of keys added since the filter was cleared.
+ * @param blocks Array of `block_count * BLOOM_FILTER_BLOCK_WORDS` words.
+ * @param key_size Size of a key, hashed when there is no `get_hash_code`.
+ * @param get_hash_code Function to get hash codes of keys, or NULL.
+ * @param hash_seed Seed of the key hashes.
+ */
+typedef struct bloom_filter_t {
+  size_t block_count; /**< Number of blocks, a power of two. */
+  size_t hash_count; /**< Number of bits set per key. */
+  size_t count; /**< Number of keys added since the filter was cleared. */
+  uint64_t *blocks; /**< Array of block_count * BLOOM_FILTER_BLOCK_WORDS
+                       words. */
+  size_t key_size; /**< Size of a key, hashed when there is no
+                      get_hash_code. */
+  get_hash_code_t get_hash_code; /**< Function to get hash codes of keys, or
+                                    NULL. */
+  size_t hash_seed; /**< Seed of the key hashes. */
+} bloom_filter_t;
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef CONCURRENT_HASH_TABLE_H
+#define CONCURRENT_HASH_TABLE_H
+#include "../hash_table/hash_table.h"
+
+#include "concurrent_hash_table_functions/base/base_functions.h"
+#include "types/concurrent_hash_table_t.h"
+
+#endif
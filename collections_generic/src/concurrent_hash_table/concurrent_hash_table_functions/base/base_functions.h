@@ -0,0 +1,111 @@
+#ifndef BASE_FUNCTIONS_CONCURRENT_HASH_TABLE_H
+#define BASE_FUNCTIONS_CONCURRENT_HASH_TABLE_H
+
+#include "../../../hash_table/hash_table.h"
+#include "../../types/concurrent_hash_table_t.h"
+
+/**
+ * Creates a new concurrent hash table. The parameters after `shard_count`
+ * are the same as for `create_hash_table`.
+ *
+ * @param shard_count number of independently locked shards, rounded up to a
+ * power of two. 0 selects `CONCURRENT_HASH_TABLE_DEFAULT_SHARDS`.
+ *
+ * @return a pointer to the newly created table, or NULL on failure
+ *
+ * @note Every shard uses flat or node storage following the same rule as
+ * `create_hash_table`.
+ */
+concurrent_hash_table_t *create_concurrent_hash_table(
+    size_t shard_count, size_t key_size, copy_t key_copy,
+    destruct_t key_destruct, compare_t key_compare, size_t value_size,
+    copy_t value_copy, destruct_t value_destruct, compare_t value_compare);
+
+/**
+ * Deallocates all memory used by the given concurrent hash table, including
+ * the table itself. No other thread may use the table at that point.
+ *
+ * @param table Pointer to the table to be deallocated.
+ */
+void destruct_concurrent_hash_table(concurrent_hash_table_t *table);
+
+/**
+ * @brief Sets the hash function of the keys, like `hash_table_t::get_hash_code`.
+ *
+ * @details Must be called before the table is shared between threads.
+ */
+void set_concurrent_hash_table_get_hash_code(concurrent_hash_table_t *table,
+                                             get_hash_code_t get_hash_code);
+
+/**
+ * @brief Adds a key-value pair, like `add_to_hash_table`.
+ *
+ * @details Takes the write lock of the key shard.
+ *
+ * @return True if the pair was added, false if the key is already present or
+ * on failure.
+ */
+bool_t add_to_concurrent_hash_table(concurrent_hash_table_t *table,
+                                    const void *key, const void *data);
+
+/**
+ * @brief Copies the value associated with a key, like `get_from_hash_table`.
+ *
+ * @details Takes the read lock of the key shard, so it runs in parallel with
+ * other lookups.
+ *
+ * @return True if the key was found and the value was copied, false
+ * otherwise.
+ */
+bool_t get_from_concurrent_hash_table(const concurrent_hash_table_t *table,
+                                      const void *key, void *data);
+
+/**
+ * @brief Checks if a key exists, like `contains_key`.
+ *
+ * @details Takes the read lock of the key shard.
+ */
+bool_t contains_key_in_concurrent_hash_table(
+    const concurrent_hash_table_t *table, const void *key);
+
+/**
+ * @brief Replaces the value associated with a key, like
+ * `change_in_hash_table`.
+ *
+ * @details Takes the write lock of the key shard.
+ *
+ * @return True if the key was found, false otherwise.
+ */
+bool_t change_in_concurrent_hash_table(concurrent_hash_table_t *table,
+                                       const void *key, const void *data);
+
+/**
+ * @brief Updates the value associated with a key in place, like
+ * `update_in_hash_table_with`.
+ *
+ * @details `update` runs under the write lock of the key shard, so
+ * read-modify-write sequences such as counters need no other locking.
+ */
+bool_t update_in_concurrent_hash_table_with(concurrent_hash_table_t *table,
+                                            const void *key, const void *value,
+                                            update_t update, void *context);
+
+/**
+ * @brief Removes a key-value pair, like `remove_from_hash_table`.
+ *
+ * @details Takes the write lock of the key shard.
+ *
+ * @return True if the key was found and removed, false otherwise.
+ */
+bool_t remove_from_concurrent_hash_table(concurrent_hash_table_t *table,
+                                         const void *key);
+
+/**
+ * @brief Returns the number of entries in the table.
+ *
+ * @details Shards are counted one after another, so with concurrent writers
+ * the result is only a snapshot of each shard at a slightly different time.
+ */
+size_t count_in_concurrent_hash_table(const concurrent_hash_table_t *table);
+
+#endif
@@ -0,0 +1,65 @@
+#include "../../../support/validators.h"
+#include "../../../hash_table/hash_table_functions/common/hash.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+concurrent_hash_table_t *create_concurrent_hash_table(
+    size_t shard_count, size_t key_size, copy_t key_copy,
+    destruct_t key_destruct, compare_t key_compare, size_t value_size,
+    copy_t value_copy, destruct_t value_destruct, compare_t value_compare) {
+
+  if (NULL_ARGUMENT_CHECK(key_compare)) {
+    return NULL;
+  }
+
+  concurrent_hash_table_t *table = calloc(1, sizeof(concurrent_hash_table_t));
+  if (MALLOC_FAILURE_CHECK(table)) {
+    return NULL;
+  }
+
+  table->shard_seed = (size_t)generate_hash_seed();
+  if (shard_count == 0)
+    shard_count = CONCURRENT_HASH_TABLE_DEFAULT_SHARDS;
+  // shards are selected by the hash bits right below the fingerprint
+  table->shard_count = 1;
+  table->shard_shift = sizeof(size_t) * 8 - 7;
+  while (table->shard_count < shard_count) {
+    table->shard_count *= 2;
+    table->shard_shift--;
+  }
+
+  table->shards = aligned_alloc(
+      CONCURRENT_HASH_TABLE_CACHE_LINE,
+      table->shard_count * sizeof(concurrent_hash_table_shard_t));
+  if (MALLOC_FAILURE_CHECK(table->shards)) {
+    free(table);
+    return NULL;
+  }
+
+  for (size_t i = 0; i < table->shard_count; i++) {
+    concurrent_hash_table_shard_t *shard = &table->shards[i];
+    shard->table = create_hash_table(key_size, key_copy, key_destruct,
+                                     key_compare, value_size, value_copy,
+                                     value_destruct, value_compare);
+    if (shard->table == NULL ||
+        !set_hash_table_seed(shard->table, table->shard_seed) ||
+        pthread_rwlock_init(&shard->lock, NULL) != 0) {
+      destruct_hash_table(shard->table);
+      table->shard_count = i;
+      destruct_concurrent_hash_table(table);
+      return NULL;
+    }
+  }
+
+  return table;
+}
+
+void set_concurrent_hash_table_get_hash_code(concurrent_hash_table_t *table,
+                                             get_hash_code_t get_hash_code) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return;
+  }
+
+  for (size_t i = 0; i < table->shard_count; i++)
+    table->shards[i].table->get_hash_code = get_hash_code;
+}
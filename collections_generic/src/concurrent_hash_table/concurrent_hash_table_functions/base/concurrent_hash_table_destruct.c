@@ -0,0 +1,14 @@
+#include "base_functions.h"
+#include <stdlib.h>
+
+void destruct_concurrent_hash_table(concurrent_hash_table_t *table) {
+  if (table == NULL)
+    return;
+
+  for (size_t i = 0; i < table->shard_count; i++) {
+    pthread_rwlock_destroy(&table->shards[i].lock);
+    destruct_hash_table(table->shards[i].table);
+  }
+  free(table->shards);
+  free(table);
+}
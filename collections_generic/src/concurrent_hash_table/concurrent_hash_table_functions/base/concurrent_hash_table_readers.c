@@ -0,0 +1,49 @@
+#include "../../../hash_table/hash_table_functions/common/hashed_functions.h"
+#include "../../../support/validators.h"
+#include "base_functions.h"
+#include "shard.h"
+
+bool_t get_from_concurrent_hash_table(const concurrent_hash_table_t *table,
+                                      const void *key, void *data) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash;
+  concurrent_hash_table_shard_t *shard = get_key_shard(table, key, &hash);
+  pthread_rwlock_rdlock(&shard->lock);
+  bool_t result = get_from_hash_table_with_hash(
+      shard->table, key, get_shard_hash(table, shard, key, hash), data);
+  pthread_rwlock_unlock(&shard->lock);
+  return result;
+}
+
+bool_t contains_key_in_concurrent_hash_table(
+    const concurrent_hash_table_t *table, const void *key) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash;
+  concurrent_hash_table_shard_t *shard = get_key_shard(table, key, &hash);
+  pthread_rwlock_rdlock(&shard->lock);
+  bool_t result = contains_key_with_hash(
+      shard->table, key, get_shard_hash(table, shard, key, hash));
+  pthread_rwlock_unlock(&shard->lock);
+  return result;
+}
+
+size_t count_in_concurrent_hash_table(const concurrent_hash_table_t *table) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return 0;
+  }
+
+  size_t count = 0;
+  for (size_t i = 0; i < table->shard_count; i++) {
+    concurrent_hash_table_shard_t *shard = &table->shards[i];
+    pthread_rwlock_rdlock(&shard->lock);
+    count += shard->table->count;
+    pthread_rwlock_unlock(&shard->lock);
+  }
+  return count;
+}
@@ -0,0 +1,68 @@
+#include "../../../hash_table/hash_table_functions/common/hashed_functions.h"
+#include "../../../support/validators.h"
+#include "base_functions.h"
+#include "shard.h"
+
+bool_t add_to_concurrent_hash_table(concurrent_hash_table_t *table,
+                                    const void *key, const void *data) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash;
+  concurrent_hash_table_shard_t *shard = get_key_shard(table, key, &hash);
+  pthread_rwlock_wrlock(&shard->lock);
+  bool_t result = add_to_hash_table_with_hash(
+      shard->table, key, get_shard_hash(table, shard, key, hash), data);
+  pthread_rwlock_unlock(&shard->lock);
+  return result;
+}
+
+bool_t change_in_concurrent_hash_table(concurrent_hash_table_t *table,
+                                       const void *key, const void *data) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash;
+  concurrent_hash_table_shard_t *shard = get_key_shard(table, key, &hash);
+  pthread_rwlock_wrlock(&shard->lock);
+  bool_t result = change_in_hash_table_with_hash(
+      shard->table, key, get_shard_hash(table, shard, key, hash), data);
+  pthread_rwlock_unlock(&shard->lock);
+  return result;
+}
+
+bool_t update_in_concurrent_hash_table_with(concurrent_hash_table_t *table,
+                                            const void *key, const void *value,
+                                            update_t update, void *context) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key) ||
+      NULL_ARGUMENT_CHECK(value) || NULL_ARGUMENT_CHECK(update)) {
+    return false;
+  }
+
+  size_t hash;
+  concurrent_hash_table_shard_t *shard = get_key_shard(table, key, &hash);
+  pthread_rwlock_wrlock(&shard->lock);
+  void *stored = upsert_in_hash_table_with_hash(
+      shard->table, key, get_shard_hash(table, shard, key, hash), value, NULL);
+  if (stored != NULL)
+    update(stored, context);
+  pthread_rwlock_unlock(&shard->lock);
+  return stored != NULL;
+}
+
+bool_t remove_from_concurrent_hash_table(concurrent_hash_table_t *table,
+                                         const void *key) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash;
+  concurrent_hash_table_shard_t *shard = get_key_shard(table, key, &hash);
+  pthread_rwlock_wrlock(&shard->lock);
+  bool_t result = remove_from_hash_table_with_hash(
+      shard->table, key, get_shard_hash(table, shard, key, hash));
+  pthread_rwlock_unlock(&shard->lock);
+  return result;
+}
@@ -0,0 +1,41 @@
+#ifndef SHARD_H
+#define SHARD_H
+
+#include "../../../hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../types/concurrent_hash_table_t.h"
+
+/**
+ * @brief Hashes a key and returns the shard holding it.
+ *
+ * @details The key is hashed once with the shard seed. The shard is selected
+ * by the bits right below the fingerprint: the low bits select the probe
+ * position inside the shard and the top bits its fingerprint, so they are
+ * left to the shard table, which is probed with the same hash.
+ *
+ * @param hash Receives the hash code of the key.
+ */
+static inline concurrent_hash_table_shard_t *
+get_key_shard(const concurrent_hash_table_t *table, const void *key,
+              size_t *hash) {
+  const hash_table_t *first = table->shards[0].table;
+  *hash = get_seeded_key_hash_code(first->get_hash_code, table->shard_seed,
+                                   first->key_manager.size_of_obj, key);
+  size_t shard = (*hash >> table->shard_shift) & (table->shard_count - 1);
+  return &table->shards[shard];
+}
+
+/**
+ * @brief Returns the hash code of a key in the table of its shard, the hash
+ * selecting the shard unless the shard has drawn a new seed.
+ *
+ * @note The shard lock must be held.
+ */
+static inline size_t get_shard_hash(const concurrent_hash_table_t *table,
+                                    const concurrent_hash_table_shard_t *shard,
+                                    const void *key, size_t hash) {
+  if (shard->table->hash_seed == table->shard_seed)
+    return hash;
+  return get_full_hash_code(shard->table, key);
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef CONCURRENT_HASH_TABLE_T_H
+#define CONCURRENT_HASH_TABLE_T_H
+
+#include <pthread.h>
+
+#include "../../hash_table/types/hash_table.h"
+
+/**
+ * @brief Number of shards used when `create_concurrent_hash_table` is given
+ * a shard count of 0.
+ */
+#define CONCURRENT_HASH_TABLE_DEFAULT_SHARDS 64
+
+/**
+ * @brief Alignment of the shards, so that two shard locks never share a cache
+ * line.
+ */
+#define CONCURRENT_HASH_TABLE_CACHE_LINE 64
+
+/**
+ * @brief One independently locked part of a concurrent hash table.
+ *
+ * @param lock Reader-writer lock guarding the table.
+ * @param table The entries of the shard.
+ */
+typedef struct concurrent_hash_table_shard_t {
+  _Alignas(CONCURRENT_HASH_TABLE_CACHE_LINE) pthread_rwlock_t lock; /**< Reader-writer lock guarding the table. */
+  hash_table_t *table; /**< The entries of the shard. */
+} concurrent_hash_table_shard_t;
+
+/**
+ * @brief A hash table safe to use from several threads at once.
+ *
+ * @details The key space is split into `shard_count` shards selected by the
+ * key hash, each one a `hash_table_t` with its own resizes guarded by its own
+ * reader-writer lock. Lookups take a read lock, so lookups of the same shard
+ * run in parallel, and operations on different shards never wait for each
+ * other.
+ *
+ * @param shard_count Number of shards, a power of two.
+ * @param shard_shift Shift bringing the bits selecting the shard of a hash
+ * down to the lowest bits.
+ * @param shards Array of shards.
+ * @param shard_seed Seed of the hashes selecting shards.
+ */
+typedef struct concurrent_hash_table_t {
+  size_t shard_count; /**< Number of shards, a power of two. */
+  size_t shard_shift; /**< Shift bringing the bits selecting the shard of a
+                         hash down to the lowest bits. */
+  concurrent_hash_table_shard_t *shards; /**< Array of shards. */
+  size_t shard_seed; /**< Seed of the hashes selecting shards. It never
+                        changes. The shard tables start with it as their
+                        seed, so the same hash probes the shard until the
+                        shard draws a new seed of its own. */
+} concurrent_hash_table_t;
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef HASH_SET_H
+#define HASH_SET_H
+#include "../hash_table/hash_table.h"
+
+#include "hash_set_functions/advanced/advanced_functions.h"
+#include "hash_set_functions/base/base_functions.h"
+#include "types/hash_set_t.h"
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef ADVANCED_FUNCTIONS_HASH_SET_H
+#define ADVANCED_FUNCTIONS_HASH_SET_H
+
+#include "../../types/hash_set_t.h"
+#include "../base/base_functions.h"
+
+/**
+ * @brief Creates the union of two hash sets.
+ *
+ * @details The result is sized once for both sets. Keys are copied with the
+ * user `copy` of `first`, and the hash codes stored in the sets are reused,
+ * so no key is hashed again. Both sets must have the same key type and hash
+ * function.
+ *
+ * @return A new set with the keys of either set, or NULL on failure.
+ */
+hash_set_t *union_hash_sets(const hash_set_t *first, const hash_set_t *second);
+
+/**
+ * @brief Creates the intersection of two hash sets.
+ *
+ * @details The smaller set is scanned and its keys are looked up in the
+ * other one with their stored hash codes. Both sets must have the same key
+ * type and hash function.
+ *
+ * @return A new set with the keys of both sets, or NULL on failure.
+ */
+hash_set_t *intersect_hash_sets(const hash_set_t *first,
+                                const hash_set_t *second);
+
+/**
+ * @brief Creates the difference of two hash sets.
+ *
+ * @details Both sets must have the same key type and hash function.
+ *
+ * @return A new set with the keys of `first` that are not in `second`, or
+ * NULL on failure.
+ */
+hash_set_t *difference_hash_sets(const hash_set_t *first,
+                                 const hash_set_t *second);
+
+#endif
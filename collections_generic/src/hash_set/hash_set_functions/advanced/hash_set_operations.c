@@ -0,0 +1,134 @@
+#include "../../../hash_table/hash_table.h"
+#include "../../../hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../../hash_table/hash_table_functions/common/insert_entry.h"
+#include "../../../hash_table/hash_table_functions/common/migration.h"
+#include "../../../hash_table/slot_functions/slot_functions.h"
+#include "../../../support/validators.h"
+#include "advanced_functions.h"
+
+static hash_set_t *create_result(const hash_set_t *model, size_t count) {
+  const type_manager_t *keys = &model->table->key_manager;
+  hash_set_t *result = create_hash_set(keys->size_of_obj, keys->copy,
+                                       keys->destruct, keys->compare);
+  if (result == NULL) {
+    return NULL;
+  }
+  result->table->get_hash_code = model->table->get_hash_code;
+  result->table->hash_seed = model->table->hash_seed;
+  if (!reserve_in_hash_table(result->table, count)) {
+    destruct_hash_set(result);
+    return NULL;
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the hash code of a key of `source` for `target`, the stored
+ * one if both tables share their seed.
+ */
+static size_t get_hash_for(const hash_table_t *target,
+                           const hash_table_t *source, const void *key,
+                           size_t hash) {
+  if (target->hash_seed == source->hash_seed)
+    return hash;
+  return get_full_hash_code(target, key);
+}
+
+/**
+ * @brief Adds the keys of the occupied slots of `source` to `result`, only
+ * those found in `filter` if `keep_found` is true, or only those missing
+ * from it otherwise. A NULL filter keeps every key.
+ */
+static bool_t add_slots(hash_table_t *result, const hash_table_t *source,
+                        const hash_table_t *filter, bool_t keep_found) {
+  for (size_t i = 0; i < source->capacity; i++) {
+    if (!IS_SLOT_OCCUPIED(source->controls[i]))
+      continue;
+
+    const void *key = get_slot_key(source, i);
+    size_t hash = source->hashes[i];
+    if (filter != NULL) {
+      const hash_table_t *owner;
+      size_t index;
+      if (find_entry_with_hash(filter, key,
+                               get_hash_for(filter, source, key, hash),
+                               &owner, &index) != keep_found)
+        continue;
+    }
+
+    hash_table_t *owner;
+    size_t index;
+    bool_t inserted;
+    if (!find_or_insert_entry_with_hash(
+            result, key, get_hash_for(result, source, key, hash), NULL,
+            &owner, &index, &inserted)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool_t add_keys(hash_set_t *result, const hash_set_t *source,
+                       const hash_set_t *filter, bool_t keep_found) {
+  const hash_table_t *table = source->table;
+  const hash_table_t *filter_table = filter != NULL ? filter->table : NULL;
+  if (!add_slots(result->table, table, filter_table, keep_found)) {
+    return false;
+  }
+  return table->migration_source == NULL ||
+         add_slots(result->table, table->migration_source, filter_table,
+                   keep_found);
+}
+
+static hash_set_t *finish_result(hash_set_t *result, bool_t success) {
+  if (!success) {
+    destruct_hash_set(result);
+    return NULL;
+  }
+  return result;
+}
+
+hash_set_t *union_hash_sets(const hash_set_t *first, const hash_set_t *second) {
+  if (NULL_ARGUMENT_CHECK(first) || NULL_ARGUMENT_CHECK(second)) {
+    return NULL;
+  }
+
+  hash_set_t *result =
+      create_result(first, first->table->count + second->table->count);
+  if (result == NULL) {
+    return NULL;
+  }
+  return finish_result(result, add_keys(result, first, NULL, false) &&
+                                   add_keys(result, second, NULL, false));
+}
+
+hash_set_t *intersect_hash_sets(const hash_set_t *first,
+                                const hash_set_t *second) {
+  if (NULL_ARGUMENT_CHECK(first) || NULL_ARGUMENT_CHECK(second)) {
+    return NULL;
+  }
+
+  if (second->table->count < first->table->count) {
+    const hash_set_t *smaller = second;
+    second = first;
+    first = smaller;
+  }
+  hash_set_t *result = create_result(first, first->table->count);
+  if (result == NULL) {
+    return NULL;
+  }
+  return finish_result(result, add_keys(result, first, second, true));
+}
+
+hash_set_t *difference_hash_sets(const hash_set_t *first,
+                                 const hash_set_t *second) {
+  if (NULL_ARGUMENT_CHECK(first) || NULL_ARGUMENT_CHECK(second)) {
+    return NULL;
+  }
+
+  hash_set_t *result = create_result(first, first->table->count);
+  if (result == NULL) {
+    return NULL;
+  }
+  return finish_result(result, add_keys(result, first, second, false));
+}
@@ -0,0 +1,64 @@
+#ifndef BASE_FUNCTIONS_HASH_SET_H
+#define BASE_FUNCTIONS_HASH_SET_H
+
+#include "../../types/hash_set_t.h"
+
+/**
+ * Creates a new hash set.
+ *
+ * @param key_size size of the keys in the set
+ * @param key_copy function for copying the keys
+ * @param key_destruct function for destroying the keys
+ * @param key_compare function for comparing the keys
+ *
+ * @return a pointer to the newly created set, or NULL on failure
+ *
+ * @note Without key_destruct, keys are stored inline like in the flat
+ * storage of `hash_table_t`.
+ */
+hash_set_t *create_hash_set(size_t key_size, copy_t key_copy,
+                            destruct_t key_destruct, compare_t key_compare);
+
+/**
+ * Deallocates all memory used by the given hash set, including the set
+ * itself.
+ *
+ * @param set Pointer to the set to be deallocated.
+ */
+void destruct_hash_set(hash_set_t *set);
+
+/**
+ * @brief Sets the hash function of the keys, like `hash_table_t::get_hash_code`.
+ *
+ * @details Must be called before any key is added. Sets combined by the set
+ * operations must use the same hash function.
+ */
+void set_hash_set_get_hash_code(hash_set_t *set,
+                                get_hash_code_t get_hash_code);
+
+/**
+ * @brief Adds a key to a hash set.
+ *
+ * @return True if the key was added, false if it is already in the set or
+ * on failure.
+ */
+bool_t add_to_hash_set(hash_set_t *set, const void *key);
+
+/**
+ * @brief Checks if a key is in a hash set.
+ */
+bool_t contains_in_hash_set(const hash_set_t *set, const void *key);
+
+/**
+ * @brief Removes a key from a hash set.
+ *
+ * @return True if the key was found and removed, false otherwise.
+ */
+bool_t remove_from_hash_set(hash_set_t *set, const void *key);
+
+/**
+ * @brief Returns the number of keys in a hash set.
+ */
+size_t count_in_hash_set(const hash_set_t *set);
+
+#endif
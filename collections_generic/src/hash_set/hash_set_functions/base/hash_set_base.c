@@ -0,0 +1,35 @@
+#include "../../../support/validators.h"
+#include "../../../hash_table/hash_table.h"
+#include "base_functions.h"
+
+bool_t add_to_hash_set(hash_set_t *set, const void *key) {
+  if (NULL_ARGUMENT_CHECK(set)) {
+    return false;
+  }
+
+  return add_to_hash_table(set->table, key, NULL);
+}
+
+bool_t contains_in_hash_set(const hash_set_t *set, const void *key) {
+  if (NULL_ARGUMENT_CHECK(set) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  return contains_key(set->table, key);
+}
+
+bool_t remove_from_hash_set(hash_set_t *set, const void *key) {
+  if (NULL_ARGUMENT_CHECK(set)) {
+    return false;
+  }
+
+  return remove_from_hash_table(set->table, key);
+}
+
+size_t count_in_hash_set(const hash_set_t *set) {
+  if (NULL_ARGUMENT_CHECK(set)) {
+    return 0;
+  }
+
+  return set->table->count;
+}
@@ -0,0 +1,37 @@
+#include "../../../support/validators.h"
+#include "../../../hash_table/hash_table.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+hash_set_t *create_hash_set(size_t key_size, copy_t key_copy,
+                            destruct_t key_destruct, compare_t key_compare) {
+  hash_set_t *set = calloc(1, sizeof(hash_set_t));
+  if (MALLOC_FAILURE_CHECK(set)) {
+    return NULL;
+  }
+
+  set->table = create_hash_table(key_size, key_copy, key_destruct, key_compare,
+                                 0, NULL, NULL, NULL);
+  if (set->table == NULL) {
+    free(set);
+    return NULL;
+  }
+  return set;
+}
+
+void destruct_hash_set(hash_set_t *set) {
+  if (set == NULL)
+    return;
+
+  destruct_hash_table(set->table);
+  free(set);
+}
+
+void set_hash_set_get_hash_code(hash_set_t *set,
+                                get_hash_code_t get_hash_code) {
+  if (NULL_ARGUMENT_CHECK(set)) {
+    return;
+  }
+
+  set->table->get_hash_code = get_hash_code;
+}
@@ -0,0 +1,20 @@
+#ifndef HASH_SET_T_H
+#define HASH_SET_T_H
+
+#include "../../hash_table/types/hash_table.h"
+
+/**
+ * @brief A set of keys.
+ *
+ * @details The set is a `hash_table_t` with zero-sized values, so it shares
+ * the hashing and probing of hash tables while storing only keys: in flat
+ * storage the keys are inline and no value memory is allocated, in node
+ * storage nodes have no value.
+ *
+ * @param table The hash table holding the keys.
+ */
+typedef struct hash_set_t {
+  hash_table_t *table; /**< The hash table holding the keys. */
+} hash_set_t;
+
+#endif
@@ -5,5 +5,8 @@
 
 #include "types/hash_table.h"
 #include "hash_table_functions/base/base_functions.h"
+#include "hash_table_functions/advanced/advanced_functions.h"
+#include "hash_table_functions/snapshot/snapshot_functions.h"
+#include "hash_table_functions/stats/stats_functions.h"
 
 #endif
\ No newline at end of file
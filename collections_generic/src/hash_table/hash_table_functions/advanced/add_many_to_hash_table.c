@@ -0,0 +1,40 @@
+#include "../../../support/validators.h"
+#include "../common/get_hash_code.h"
+#include "../common/insert_entry.h"
+#include "../common/migration.h"
+#include "advanced_functions.h"
+
+size_t add_many_to_hash_table(hash_table_t *table, const void *keys,
+                              const void *values, size_t count) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(keys)) {
+    return 0;
+  }
+
+  finish_migration(table);
+  if (!reserve_in_hash_table(table, table->count + count)) {
+    return 0;
+  }
+
+  const char *key_bytes = keys;
+  const char *value_bytes = values;
+  size_t key_size = table->key_manager.size_of_obj;
+  size_t value_size = table->value_manager.size_of_obj;
+  size_t added = 0;
+  for (size_t i = 0; i < count; i++) {
+    const void *key = key_bytes + i * key_size;
+    const void *value = value_bytes != NULL ? value_bytes + i * value_size : NULL;
+
+    hash_table_t *owner;
+    size_t index;
+    bool_t inserted;
+    if (!find_or_insert_entry_with_hash(table, key,
+                                        get_full_hash_code(table, key), value,
+                                        &owner, &index, &inserted)) {
+      break;
+    }
+    if (inserted) {
+      added++;
+    }
+  }
+  return added;
+}
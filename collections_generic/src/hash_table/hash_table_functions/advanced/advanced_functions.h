@@ -0,0 +1,170 @@
+#ifndef ADVANCED_FUNCTIONS_HASH_TABLE_H
+#define ADVANCED_FUNCTIONS_HASH_TABLE_H
+
+#include "../../types/hash_table.h"
+#include "../../types/key_value_pair.h"
+#include "../base/base_functions.h"
+
+/**
+ * @brief Finds the value associated with a key, inserting the key with the
+ * given value first if it is missing.
+ *
+ * @details The key is hashed and probed once. The key and `value` are copied
+ * only when a new entry is created, an existing value is left as it is. The
+ * returned pointer addresses the value stored in the table and stays valid
+ * until the next insertion or removal.
+ *
+ * @param table A pointer to the hash table.
+ * @param key A pointer to the key to find or insert.
+ * @param value A pointer to the value of a new entry. If NULL, the new value
+ * is zeroed in flat storage and not allocated in node storage.
+ * @param inserted Receives true if a new entry was created, may be NULL.
+ * @return A pointer to the stored value, or NULL on failure (or if the entry
+ * has no value in node storage).
+ */
+void *upsert_in_hash_table(hash_table_t *table, const void *key,
+                           const void *value, bool_t *inserted);
+
+/**
+ * @brief Updates the value associated with a key in place, inserting the key
+ * with the given value first if it is missing.
+ *
+ * @details The key is hashed and probed once, then `update` is called with
+ * the stored value, either the existing one or a copy of `value`, and
+ * `context`. For example, counting words only needs an `update` incrementing
+ * an int and a zero `value`.
+ *
+ * @param table A pointer to the hash table.
+ * @param key A pointer to the key to find or insert.
+ * @param value A pointer to the value of a new entry.
+ * @param update Function modifying the stored value.
+ * @param context Passed to `update` as is, may be NULL.
+ * @return True on success, false on failure.
+ */
+bool_t update_in_hash_table_with(hash_table_t *table, const void *key,
+                                 const void *value, update_t update,
+                                 void *context);
+
+/**
+ * @brief Returns a pointer to the value associated with a key without
+ * copying it.
+ *
+ * @details The value is borrowed from the table: it must not be modified or
+ * freed, and the pointer stays valid until the next insertion or removal.
+ *
+ * @param table A pointer to the hash table to search in.
+ * @param key A pointer to the key to search for.
+ * @return A pointer to the stored value, or NULL if the key is not found (or
+ * if the entry has no value in node storage).
+ */
+const void *get_pointer_from_hash_table(const hash_table_t *table,
+                                        const void *key);
+
+/**
+ * @brief Fills a key-value pair with pointers to the stored key and value
+ * associated with a key, without copying them.
+ *
+ * @details Both pointers are borrowed from the table, with the same rules as
+ * `get_pointer_from_hash_table`. The pair is not modified if the key is not
+ * found.
+ *
+ * @param table A pointer to the hash table to search in.
+ * @param key A pointer to the key to search for.
+ * @param pair A pointer to the pair to fill.
+ * @return True if the key was found, false otherwise.
+ */
+bool_t get_key_value_pair_from_hash_table(const hash_table_t *table,
+                                          const void *key,
+                                          key_value_pair_t *pair);
+
+/**
+ * @brief Gets the values associated with many keys at once.
+ *
+ * @details Keys are handled in batches of `HASH_TABLE_LOOKUP_BATCH`: every
+ * key of a batch is hashed and the first slots it probes are prefetched
+ * before any of them is probed, so the cache misses of the batch overlap
+ * instead of being paid one after another. Values are copied like in
+ * `get_from_hash_table`.
+ *
+ * @param table A pointer to the hash table to search in.
+ * @param keys An array of `count` keys, stored contiguously.
+ * @param count The number of keys.
+ * @param values An array of `count` values receiving the value of every key
+ * that is found. The values of missing keys are not modified.
+ * @param found_mask An array of `count` flags, set to true for the keys that
+ * are found and false for the others. May be NULL.
+ * @return The number of keys found.
+ */
+size_t get_many_from_hash_table(const hash_table_t *table, const void *keys,
+                                size_t count, void *values,
+                                bool_t *found_mask);
+
+/**
+ * @brief Adds many key-value pairs from parallel arrays at once.
+ *
+ * @details The table is sized once for all the new entries with
+ * `reserve_in_hash_table`, then the pairs are inserted without the load
+ * checks `add_to_hash_table` does before every insertion. Keys already in
+ * the table, or repeated in `keys`, are skipped like in `add_to_hash_table`.
+ *
+ * @param table A pointer to the hash table.
+ * @param keys An array of `count` keys, stored contiguously.
+ * @param values An array of `count` values, stored contiguously. May be
+ * NULL, the entries are then added like with a NULL value in
+ * `add_to_hash_table`.
+ * @param count The number of pairs.
+ * @return The number of pairs added.
+ */
+size_t add_many_to_hash_table(hash_table_t *table, const void *keys,
+                              const void *values, size_t count);
+
+/**
+ * @brief Creates a copy of a hash table with copies of all of its entries.
+ *
+ * @details Keys and values are copied with the user `copy` of the table, the
+ * stored hash codes are reused so keys are not hashed again. The copy has
+ * the same type managers, hash function and settings, sized for the current
+ * entry count.
+ *
+ * @param table A pointer to the hash table to copy.
+ * @return A pointer to the new hash table, or NULL on failure.
+ */
+hash_table_t *clone_hash_table(const hash_table_t *table);
+
+/**
+ * @brief Iterates over the entries of a hash table.
+ *
+ * @details Start with `*position` set to 0 and call until it returns false.
+ * The pair receives pointers to the stored key and value, valid until the
+ * next insertion, removal or resize; nothing is copied. Empty and deleted
+ * slots are skipped a group of control bytes at a time. The order is the
+ * slot order, unrelated to the insertion order.
+ *
+ * @param table A pointer to the hash table.
+ * @param position The iteration state, advanced past the returned entry.
+ * @param pair Receives the next entry.
+ * @return True if an entry was returned, false at the end of the table.
+ */
+bool_t next_in_hash_table(const hash_table_t *table, size_t *position,
+                          key_value_pair_t *pair);
+
+/**
+ * @brief Copies every entry of a hash table into contiguous arrays.
+ *
+ * @details Entries are written in the order of `next_in_hash_table`. Keys
+ * and values are copied with the user `copy` when there is one; otherwise
+ * runs of consecutive occupied slots of flat storage are copied with one
+ * `memcpy` each. Missing values of node storage are written as zeros.
+ *
+ * @param table A pointer to the hash table.
+ * @param keys An array of at least `capacity` keys receiving the keys.
+ * @param values An array of at least `capacity` values receiving the
+ * values, or NULL to export the keys only.
+ * @param capacity The number of entries the arrays can hold.
+ * @return The number of entries written, less than `table->count` if the
+ * arrays are too small.
+ */
+size_t hash_table_export(const hash_table_t *table, void *keys, void *values,
+                         size_t capacity);
+
+#endif
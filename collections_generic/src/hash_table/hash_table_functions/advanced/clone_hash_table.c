@@ -0,0 +1,55 @@
+#include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../common/insert_entry.h"
+#include "advanced_functions.h"
+
+static bool_t clone_slots(const hash_table_t *source, hash_table_t *clone) {
+  for (size_t i = 0; i < source->capacity; i++) {
+    if (!IS_SLOT_OCCUPIED(source->controls[i]))
+      continue;
+
+    hash_table_t *owner;
+    size_t index;
+    bool_t inserted;
+    if (!find_or_insert_entry_with_hash(
+            clone, get_slot_key(source, i), source->hashes[i],
+            get_slot_value(source, i), &owner, &index, &inserted)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+hash_table_t *clone_hash_table(const hash_table_t *table) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return NULL;
+  }
+
+  const type_manager_t *keys = &table->key_manager;
+  const type_manager_t *values = &table->value_manager;
+  hash_table_t *clone = create_hash_table_with_capacity(
+      table->count, keys->size_of_obj, keys->copy, keys->destruct,
+      keys->compare, values->size_of_obj, values->copy, values->destruct,
+      values->compare);
+  if (clone == NULL) {
+    return NULL;
+  }
+  clone->get_hash_code = table->get_hash_code;
+  // the stored hash codes are reused, so they must have the same seed
+  clone->hash_seed = table->hash_seed;
+  clone->incremental_resize = table->incremental_resize;
+  clone->auto_shrink = table->auto_shrink;
+  clone->resize_threads = table->resize_threads;
+
+  bool_t success = set_hash_table_probing(clone, table->probing) &&
+                   set_hash_table_filter(clone, table->filter != NULL) &&
+                   clone_slots(table, clone);
+  if (success && table->migration_source != NULL) {
+    success = clone_slots(table->migration_source, clone);
+  }
+  if (!success) {
+    destruct_hash_table(clone);
+    return NULL;
+  }
+  return clone;
+}
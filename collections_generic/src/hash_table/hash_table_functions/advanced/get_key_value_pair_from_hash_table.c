@@ -0,0 +1,22 @@
+#include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../common/migration.h"
+#include "advanced_functions.h"
+
+bool_t get_key_value_pair_from_hash_table(const hash_table_t *table,
+                                          const void *key,
+                                          key_value_pair_t *pair) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key) ||
+      NULL_ARGUMENT_CHECK(pair)) {
+    return false;
+  }
+
+  const hash_table_t *owner;
+  size_t index;
+  if (!find_entry(table, key, &owner, &index)) {
+    return false;
+  }
+  pair->key = get_slot_key(owner, index);
+  pair->value = get_slot_value(owner, index);
+  return true;
+}
@@ -0,0 +1,52 @@
+#include "../../../support/validators.h"
+#include "../../probe_functions/probe_functions.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../../type_manager_functions/type_manager_functions.h"
+#include "../common/get_hash_code.h"
+#include "../common/migration.h"
+#include "advanced_functions.h"
+
+size_t get_many_from_hash_table(const hash_table_t *table, const void *keys,
+                                size_t count, void *values,
+                                bool_t *found_mask) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(keys) ||
+      NULL_ARGUMENT_CHECK(values)) {
+    return 0;
+  }
+
+  const char *key_bytes = keys;
+  char *value_bytes = values;
+  size_t key_size = table->key_manager.size_of_obj;
+  size_t value_size = table->value_manager.size_of_obj;
+  size_t hashes[HASH_TABLE_LOOKUP_BATCH];
+  size_t found_count = 0;
+
+  for (size_t first = 0; first < count; first += HASH_TABLE_LOOKUP_BATCH) {
+    size_t batch = count - first < HASH_TABLE_LOOKUP_BATCH
+                       ? count - first
+                       : HASH_TABLE_LOOKUP_BATCH;
+
+    // hash the whole batch and start fetching the home slots
+    for (size_t i = 0; i < batch; i++) {
+      hashes[i] = get_full_hash_code(table, key_bytes + (first + i) * key_size);
+      prefetch_key_slot(table, hashes[i]);
+    }
+
+    for (size_t i = 0; i < batch; i++) {
+      const hash_table_t *owner;
+      size_t index;
+      bool_t found = find_entry_with_hash(
+          table, key_bytes + (first + i) * key_size, hashes[i], &owner, &index);
+      if (found) {
+        use_user_copy_or_memcpy(&table->value_manager,
+                                get_slot_value(owner, index),
+                                value_bytes + (first + i) * value_size);
+        found_count++;
+      }
+      if (found_mask != NULL) {
+        found_mask[first + i] = found;
+      }
+    }
+  }
+  return found_count;
+}
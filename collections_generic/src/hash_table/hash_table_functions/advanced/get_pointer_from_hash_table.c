@@ -0,0 +1,18 @@
+#include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../common/migration.h"
+#include "advanced_functions.h"
+
+const void *get_pointer_from_hash_table(const hash_table_t *table,
+                                        const void *key) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return NULL;
+  }
+
+  const hash_table_t *owner;
+  size_t index;
+  if (!find_entry(table, key, &owner, &index)) {
+    return NULL;
+  }
+  return get_slot_value(owner, index);
+}
@@ -0,0 +1,69 @@
+#include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../../type_manager_functions/type_manager_functions.h"
+#include "../common/occupied_slots.h"
+#include "advanced_functions.h"
+
+#include <string.h>
+
+static void export_objects(const hash_table_t *slots,
+                           const type_manager_t *manager, const char *array,
+                           size_t index, size_t run, char *destination,
+                           bool_t is_key) {
+  size_t size = manager->size_of_obj;
+  if (slots->storage == FLAT_STORAGE && manager->copy == NULL) {
+    // consecutive slots are contiguous in flat storage
+    memcpy(destination, array + index * size, run * size);
+    return;
+  }
+
+  for (size_t i = 0; i < run; i++, destination += size) {
+    const void *object = is_key ? get_slot_key(slots, index + i)
+                                : get_slot_value(slots, index + i);
+    if (object != NULL)
+      use_user_copy_or_memcpy(manager, object, destination);
+    else
+      memset(destination, 0, size);
+  }
+}
+
+static size_t export_slots(const hash_table_t *slots, char *keys,
+                           char *values, size_t capacity) {
+  size_t key_size = slots->key_manager.size_of_obj;
+  size_t value_size = slots->value_manager.size_of_obj;
+  size_t written = 0;
+  size_t index = next_occupied_slot(slots, 0);
+  while (index < slots->capacity && written < capacity) {
+    size_t run = occupied_run_length(slots, index);
+    if (run > capacity - written)
+      run = capacity - written;
+
+    export_objects(slots, &slots->key_manager, slots->keys, index, run,
+                   keys + written * key_size, true);
+    if (values != NULL && value_size > 0) {
+      export_objects(slots, &slots->value_manager, slots->values, index, run,
+                     values + written * value_size, false);
+    }
+    written += run;
+    index = next_occupied_slot(slots, index + run);
+  }
+  return written;
+}
+
+size_t hash_table_export(const hash_table_t *table, void *keys, void *values,
+                         size_t capacity) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(keys)) {
+    return 0;
+  }
+
+  size_t written = export_slots(table, keys, values, capacity);
+  if (table->migration_source != NULL) {
+    size_t key_size = table->key_manager.size_of_obj;
+    size_t value_size = table->value_manager.size_of_obj;
+    written += export_slots(
+        table->migration_source, (char *)keys + written * key_size,
+        values != NULL ? (char *)values + written * value_size : NULL,
+        capacity - written);
+  }
+  return written;
+}
@@ -0,0 +1,37 @@
+#include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../common/occupied_slots.h"
+#include "advanced_functions.h"
+
+bool_t next_in_hash_table(const hash_table_t *table, size_t *position,
+                          key_value_pair_t *pair) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(position) ||
+      NULL_ARGUMENT_CHECK(pair)) {
+    return false;
+  }
+
+  // positions past the table slots refer to the slots still being migrated
+  const hash_table_t *slots = table;
+  size_t index = *position;
+  if (index >= table->capacity && table->migration_source != NULL) {
+    slots = table->migration_source;
+    index -= table->capacity;
+  }
+
+  index = next_occupied_slot(slots, index);
+  if (index == slots->capacity && slots == table &&
+      table->migration_source != NULL) {
+    slots = table->migration_source;
+    index = next_occupied_slot(slots, 0);
+  }
+  if (index == slots->capacity) {
+    *position = slots == table ? table->capacity
+                               : table->capacity + slots->capacity;
+    return false;
+  }
+
+  pair->key = get_slot_key(slots, index);
+  pair->value = get_slot_value(slots, index);
+  *position = (slots == table ? 0 : table->capacity) + index + 1;
+  return true;
+}
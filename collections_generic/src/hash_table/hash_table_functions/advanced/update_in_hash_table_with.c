@@ -0,0 +1,18 @@
+#include "../../../support/validators.h"
+#include "advanced_functions.h"
+
+bool_t update_in_hash_table_with(hash_table_t *table, const void *key,
+                                 const void *value, update_t update,
+                                 void *context) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key) ||
+      NULL_ARGUMENT_CHECK(value) || NULL_ARGUMENT_CHECK(update)) {
+    return false;
+  }
+
+  void *stored = upsert_in_hash_table(table, key, value, NULL);
+  if (stored == NULL) {
+    return false;
+  }
+  update(stored, context);
+  return true;
+}
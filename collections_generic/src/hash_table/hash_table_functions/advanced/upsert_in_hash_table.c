@@ -0,0 +1,37 @@
+#include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../common/get_hash_code.h"
+#include "../common/hashed_functions.h"
+#include "../common/insert_entry.h"
+#include "advanced_functions.h"
+
+void *upsert_in_hash_table(hash_table_t *table, const void *key,
+                           const void *value, bool_t *inserted) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return NULL;
+  }
+
+  return upsert_in_hash_table_with_hash(table, key,
+                                        get_full_hash_code(table, key), value,
+                                        inserted);
+}
+
+void *upsert_in_hash_table_with_hash(hash_table_t *table, const void *key,
+                                     size_t hash, const void *value,
+                                     bool_t *inserted) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return NULL;
+  }
+
+  hash_table_t *owner;
+  size_t index;
+  bool_t is_new;
+  if (!find_or_insert_entry(table, key, hash, value, &owner, &index,
+                            &is_new)) {
+    return NULL;
+  }
+  if (inserted != NULL) {
+    *inserted = is_new;
+  }
+  return get_slot_value(owner, index);
+}
@@ -22,6 +22,9 @@
  * @note Value_compare can be NULL.
  * @note If you do not set the destruct and copy functions, `free` and `memcpy`
  * will be used by default.
+ * @note If neither key_destruct nor value_destruct is set, the table uses
+ * flat storage (keys and values inline in contiguous arrays), otherwise every
+ * entry is a separately allocated node. See `hash_table_storage_t`.
  */
 hash_table_t *create_hash_table(size_t key_size, copy_t key_copy,
                                 destruct_t key_destruct, compare_t key_compare,
@@ -30,7 +33,25 @@ hash_table_t *create_hash_table(size_t key_size, copy_t key_copy,
                                 compare_t value_compare);
 
 /**
- * Deallocates all memory used by the given hash table.
+ * Creates a new hash table sized to hold the expected number of entries
+ * without growing.
+ *
+ * @param expected_count number of entries the table should hold before its
+ * first resize
+ *
+ * The other parameters and the notes are the same as for
+ * `create_hash_table`, which is equivalent to an `expected_count` of 0.
+ *
+ * @return a pointer to the newly created hash table
+ */
+hash_table_t *create_hash_table_with_capacity(
+    size_t expected_count, size_t key_size, copy_t key_copy,
+    destruct_t key_destruct, compare_t key_compare, size_t value_size,
+    copy_t value_copy, destruct_t value_destruct, compare_t value_compare);
+
+/**
+ * Deallocates all memory used by the given hash table, including the table
+ * itself.
  *
  * @param table Pointer to the hash table to be deallocated.
  */
@@ -44,25 +65,111 @@ bool_t add_to_hash_table(hash_table_t *table, const void *key, const void *data)
  * @param table Pointer to the hash table to rehash
  *
  * @details This function rehashes the given hash table to improve its
- * performance. It resets the number of items in the hash table, creates a new
- * array of nodes, swaps the old node array with the new one, rehashes the
- * elements, destructs the old nodes, and frees the memory used by the old node
- * array. The hash table's destruct functions are used to destruct the old
- * nodes.
+ * performance. It creates new slot arrays of the same capacity, moves every
+ * live entry into them and frees the old arrays, dropping deleted slots on
+ * the way. Entries are relocated as they are: the hash table's copy and
+ * destruct functions are not called.
  */
 void re_hash_hash_table(hash_table_t *table);
 
 /**
  * @brief Resizes a hash table to twice its current capacity.
  *
- * This function doubles the capacity of the hash table, creates a new array of
- * nodes with the new capacity, and rehashes all of the existing key-value
- * pairs into the new array. The old array is then destroyed and the hash table
- * is updated to use the new array.
+ * This function doubles the capacity of the hash table, creates new slot
+ * arrays with the new capacity, and moves all of the existing key-value pairs
+ * into them without copying or destructing them. The old arrays are then
+ * freed and the hash table is updated to use the new ones.
  *
  * @param table A pointer to the hash table to resize.
+ * @return True on success, false on allocation failure or if the table is
+ * read-only (the table keeps its old slots in that case).
+ */
+bool_t resize_hash_table(hash_table_t *table);
+
+/**
+ * @brief Grows a hash table so that it holds at least `count` entries
+ * without resizing.
+ *
+ * @details Entries are moved into new slot arrays of the needed capacity at
+ * once, like in `resize_hash_table`. Does nothing if the table is already
+ * large enough.
+ *
+ * @param table A pointer to the hash table.
+ * @param count The number of entries to make room for, including those
+ * already in the table.
+ * @return True on success, false on allocation failure (the table is not
+ * modified in that case).
+ */
+bool_t reserve_in_hash_table(hash_table_t *table, size_t count);
+
+/**
+ * @brief Shrinks a hash table to the smallest capacity holding its entries
+ * without resizing, and drops its deleted slots.
+ *
+ * @details Entries are moved into new slot arrays at once, like in
+ * `re_hash_hash_table`, and the old, larger arrays are freed. The capacity
+ * never goes below `DEFAULT_HASH_TABLE_SIZE`. Does nothing if the table is
+ * already that small and has no deleted slots. Tables with `auto_shrink` set
+ * are shrunk by `remove_from_hash_table` once their count falls below
+ * `HASH_TABLE_SHRINK_THRESHOLD` of their capacity.
+ *
+ * @param table A pointer to the hash table.
+ * @return True on success, false on allocation failure or if the table is
+ * read-only (the table is not modified in that case).
+ */
+bool_t shrink_hash_table(hash_table_t *table);
+
+/**
+ * @brief Switches the hash table to the given probing mode.
+ *
+ * @details Existing entries are moved into new slot arrays probed the new
+ * way. Robin Hood probing never leaves deleted slots behind, which suits
+ * tables with as many removals as insertions.
+ *
+ * @param table A pointer to the hash table.
+ * @param probing The probing mode to use.
+ * @return True on success, false on allocation failure (the table keeps its
+ * previous probing mode in that case).
+ */
+bool_t set_hash_table_probing(hash_table_t *table,
+                              hash_table_probing_t probing);
+
+/**
+ * @brief Rehashes every key of the hash table with the given seed.
+ *
+ * @details New tables get a random seed, so hash codes differ between tables
+ * and runs, and keys crafted to collide in one table do not collide in
+ * another. A seed of 0 gives the unseeded, reproducible hash codes. The table
+ * may still draw a random seed later if insertions find abnormally long
+ * probe sequences, see `HASH_TABLE_LONG_PROBE`. A user `get_hash_code`
+ * only hashes keys differently for another seed if it uses its `key_gen`
+ * argument.
+ *
+ * @param table A pointer to the hash table.
+ * @param seed The new seed.
+ * @return True on success, false on allocation failure or if the table is
+ * read-only (the table keeps its previous seed in that case).
+ */
+bool_t set_hash_table_seed(hash_table_t *table, size_t seed);
+
+/**
+ * @brief Enables or disables the Bloom filter of the hash table.
+ *
+ * @details A filtered table keeps a blocked Bloom filter of the hashes of its
+ * keys, about 10 bits per slot of capacity, and checks it before probing. A
+ * lookup of an absent key then reads one cache line of the filter instead of
+ * the slots in about 99% of cases, which pays off when most lookups miss.
+ * Insertions set the bits of their key; removals cannot clear them, so the
+ * filter is refilled from the table once most of its hashes are stale, and
+ * on every resize. Off by default. Tables opened from a snapshot may have a
+ * filter too, it is built in memory.
+ *
+ * @param table A pointer to the hash table.
+ * @param enabled True to build the filter, false to free it.
+ * @return True on success, false on allocation failure (the table is left
+ * without a filter in that case).
  */
-void resize_hash_table(hash_table_t *table);
+bool_t set_hash_table_filter(hash_table_t *table, bool_t enabled);
 
 /**
  * @brief Checks if a key exists in a given hash table.
@@ -1,6 +1,10 @@
 #include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
 #include "../../type_manager_functions/type_manager_functions.h"
 #include "../common/get_hash_code.h"
+#include "../common/hashed_functions.h"
+#include "../common/migration.h"
+#include "../common/read_only.h"
 #include "base_functions.h"
 
 bool_t change_in_hash_table(hash_table_t *table, const void *key,
@@ -10,17 +14,25 @@ bool_t change_in_hash_table(hash_table_t *table, const void *key,
     return false;
   }
 
-  size_t hash1 = get_hash_code_1(table, key);
-  size_t hash2 = get_hash_code_2(table, key);
+  return change_in_hash_table_with_hash(table, key,
+                                        get_full_hash_code(table, key), data);
+}
 
-  for (size_t i = 0; table->nodes[hash1] != NULL && i < table->capacity; i++) {
-    if (table->key_manager.compare(table->nodes[hash1]->key, key) == 0 &&
-        !table->nodes[hash1]->is_deleted) {
-      use_user_copy_or_memcpy(&table->value_manager, data,
-                              table->nodes[hash1]->value);
-      return true;
-    }
-    hash1 = (hash1 + hash2) % table->capacity;
+bool_t change_in_hash_table_with_hash(hash_table_t *table, const void *key,
+                                      size_t hash, const void *data) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+  if (read_only_check(table)) {
+    return false;
+  }
+
+  const hash_table_t *owner;
+  size_t index;
+  if (!find_entry_with_hash(table, key, hash, &owner, &index)) {
+    return false;
   }
-  return false;
-}
\ No newline at end of file
+  use_user_copy_or_memcpy(&table->value_manager, data,
+                          get_slot_value(owner, index));
+  return true;
+}
@@ -1,11 +1,24 @@
 #include "../../../support/validators.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../common/capacity.h"
+#include "../common/hash.h"
 #include "base_functions.h"
 #include <stdlib.h>
+#include <string.h>
 hash_table_t *create_hash_table(size_t key_size, copy_t key_copy,
                                 destruct_t key_destruct, compare_t key_compare,
                                 size_t value_size, copy_t value_copy,
                                 destruct_t value_destruct,
                                 compare_t value_compare) {
+  return create_hash_table_with_capacity(
+      0, key_size, key_copy, key_destruct, key_compare, value_size, value_copy,
+      value_destruct, value_compare);
+}
+
+hash_table_t *create_hash_table_with_capacity(
+    size_t expected_count, size_t key_size, copy_t key_copy,
+    destruct_t key_destruct, compare_t key_compare, size_t value_size,
+    copy_t value_copy, destruct_t value_destruct, compare_t value_compare) {
 
   if (NULL_ARGUMENT_CHECK(key_compare)) {
     return NULL;
@@ -16,19 +29,6 @@ hash_table_t *create_hash_table(size_t key_size, copy_t key_copy,
     return NULL;
   }
 
-  table->capacity = DEFAULT_HASH_TABLE_SIZE;
-  table->nodes = malloc(sizeof(hash_table_node_t *) * table->capacity);
-  if (MALLOC_FAILURE_CHECK(table->nodes)) {
-    free(table);
-    return NULL;
-  }
-
-  for (size_t i = 0; i < DEFAULT_HASH_TABLE_SIZE; i++) {
-    table->nodes[i] = NULL;
-  }
-
-  table->count = 0;
-  table->count_with_deleted = 0;
   type_manager_t tmp1 = {key_size, .copy = key_copy, .destruct = key_destruct,
                          .compare = key_compare};
   table->key_manager = tmp1;
@@ -36,5 +36,35 @@ hash_table_t *create_hash_table(size_t key_size, copy_t key_copy,
                          .destruct = value_destruct, .compare = value_compare};
   table->value_manager = tmp2;
 
+  table->storage = (key_destruct == NULL && value_destruct == NULL)
+                       ? FLAT_STORAGE
+                       : NODE_STORAGE;
+  table->probing = GROUP_PROBING;
+  table->capacity = get_capacity_for_count(expected_count);
+  if (table->capacity < DEFAULT_HASH_TABLE_SIZE)
+    table->capacity = DEFAULT_HASH_TABLE_SIZE;
+  if (!allocate_slots(table, table->capacity)) {
+    free(table);
+    return NULL;
+  }
+
+  table->count = 0;
+  table->count_with_deleted = 0;
+  table->get_hash_code = NULL;
+  table->hash_seed = (size_t)generate_hash_seed();
+  table->long_probe_seen = false;
+  table->count_at_reseed = 0;
+  table->incremental_resize = false;
+  table->auto_shrink = false;
+  table->resize_threads = 0;
+  table->migration_source = NULL;
+  table->migrated_slots = 0;
+  table->mapping = NULL;
+  table->mapping_size = 0;
+  table->filter = NULL;
+#ifdef HASH_TABLE_STATS
+  memset(&table->counters, 0, sizeof(table->counters));
+#endif
+
   return table;
-}
\ No newline at end of file
+}
@@ -1,14 +1,32 @@
-#include "../../node_functions/node_functions.h"
+#include "../../../bloom_filter/bloom_filter.h"
+#include "../../slot_functions/slot_functions.h"
 #include "base_functions.h"
 #include <stdlib.h>
+#include <sys/mman.h>
+
+static void destruct_slots(hash_table_t *table) {
+  for (size_t i = 0; i < table->capacity; i++) {
+    if (IS_SLOT_OCCUPIED(table->controls[i]))
+      destruct_slot(table, i);
+  }
+  free_slots(table);
+}
 
 void destruct_hash_table(hash_table_t *table) {
   if (table == NULL)
     return;
 
-  for (size_t i = 0; i < table->capacity; i++) {
-    destruct_hash_table_node(&table->key_manager, &table->value_manager,
-                             table->nodes[i]);
+  destruct_bloom_filter(table->filter);
+  if (table->mapping != NULL) {
+    // the slot arrays belong to the snapshot mapping
+    munmap(table->mapping, table->mapping_size);
+    free(table);
+    return;
+  }
+  if (table->migration_source != NULL) {
+    destruct_slots(table->migration_source);
+    free(table->migration_source);
   }
-  free(table->nodes);
+  destruct_slots(table);
+  free(table);
 }
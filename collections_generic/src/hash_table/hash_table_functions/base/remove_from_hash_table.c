@@ -1,25 +1,60 @@
 #include "../../../support/validators.h"
+#include "../../probe_functions/probe_functions.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../common/filter.h"
 #include "../common/get_hash_code.h"
+#include "../common/hashed_functions.h"
+#include "../common/migration.h"
+#include "../common/read_only.h"
 #include "base_functions.h"
 
 bool_t remove_from_hash_table(hash_table_t *table, const void *key) {
   if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
     return false;
   }
-  size_t hash1 = get_hash_code_1(table, key);
-  size_t hash2 = get_hash_code_2(table, key);
-  size_t i = 0;
 
-  while (table->nodes[hash1] != NULL && i < table->capacity) {
-    if (table->key_manager.compare(table->nodes[hash1]->key, key) == 0 &&
-        !table->nodes[hash1]->is_deleted) {
-      table->nodes[hash1]->is_deleted = true;
-      table->count--;
-      return true;
-    }
+  return remove_from_hash_table_with_hash(table, key,
+                                          get_full_hash_code(table, key));
+}
 
-    hash1 = (hash1 + hash2) % table->capacity;
-    i++;
+bool_t remove_from_hash_table_with_hash(hash_table_t *table, const void *key,
+                                        size_t hash) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+  if (read_only_check(table)) {
+    return false;
+  }
+
+  migrate_slots(table, HASH_TABLE_MIGRATION_STEP);
+
+  const hash_table_t *owner;
+  size_t index;
+  if (!find_entry_with_hash(table, key, hash, &owner, &index)) {
+    return false;
+  }
+
+  if (owner == table) {
+    destruct_slot(table, index);
+    release_slot(table, index);
+  } else {
+    // old slots are only marked, they are dropped when the migration ends
+    hash_table_t *source = table->migration_source;
+    destruct_slot(source, index);
+    source->controls[index] = SLOT_DELETED;
+    source->count--;
+  }
+  table->count--;
+
+  // the filter cannot forget hashes, it is refilled once most are stale
+  if (table->filter != NULL &&
+      table->filter->count > table->count * 2 + DEFAULT_HASH_TABLE_SIZE) {
+    rebuild_filter(table);
+  }
+  if (table->auto_shrink && table->migration_source == NULL &&
+      table->capacity > DEFAULT_HASH_TABLE_SIZE &&
+      table->count < table->capacity * HASH_TABLE_SHRINK_THRESHOLD) {
+    shrink_hash_table(table);
   }
-  return false;
-}
\ No newline at end of file
+  return true;
+}
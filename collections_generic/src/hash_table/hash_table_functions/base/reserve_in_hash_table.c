@@ -0,0 +1,16 @@
+#include "../../../support/validators.h"
+#include "../common/capacity.h"
+#include "../common/rebuild_slots.h"
+#include "base_functions.h"
+
+bool_t reserve_in_hash_table(hash_table_t *table, size_t count) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return false;
+  }
+
+  size_t capacity = get_capacity_for_count(count);
+  if (capacity <= table->capacity) {
+    return true;
+  }
+  return rebuild_slots(table, capacity);
+}
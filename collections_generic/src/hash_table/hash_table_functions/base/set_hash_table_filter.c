@@ -0,0 +1,22 @@
+#include "../../../bloom_filter/bloom_filter.h"
+#include "../../../support/validators.h"
+#include "../common/filter.h"
+#include "base_functions.h"
+
+bool_t set_hash_table_filter(hash_table_t *table, bool_t enabled) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return false;
+  }
+  if ((table->filter != NULL) == (enabled != false)) {
+    return true;
+  }
+
+  if (!enabled) {
+    destruct_bloom_filter(table->filter);
+    table->filter = NULL;
+    return true;
+  }
+
+  table->filter = create_table_filter(table);
+  return table->filter != NULL;
+}
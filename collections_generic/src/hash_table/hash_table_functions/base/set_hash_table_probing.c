@@ -0,0 +1,24 @@
+#include "../../../support/validators.h"
+#include "../common/migration.h"
+#include "../common/rebuild_slots.h"
+#include "base_functions.h"
+
+bool_t set_hash_table_probing(hash_table_t *table,
+                              hash_table_probing_t probing) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return false;
+  }
+  if (table->probing == probing) {
+    return true;
+  }
+
+  // the old slots are moved with the probing they were laid out for
+  finish_migration(table);
+  hash_table_probing_t previous = table->probing;
+  table->probing = probing;
+  if (!rebuild_slots(table, table->capacity)) {
+    table->probing = previous;
+    return false;
+  }
+  return true;
+}
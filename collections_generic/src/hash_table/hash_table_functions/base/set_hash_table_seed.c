@@ -0,0 +1,14 @@
+#include "../../../support/validators.h"
+#include "../common/rebuild_slots.h"
+#include "base_functions.h"
+
+bool_t set_hash_table_seed(hash_table_t *table, size_t seed) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return false;
+  }
+  if (table->hash_seed == seed) {
+    return true;
+  }
+
+  return reseed_slots(table, seed);
+}
@@ -0,0 +1,19 @@
+#include "../../../support/validators.h"
+#include "../common/capacity.h"
+#include "../common/rebuild_slots.h"
+#include "base_functions.h"
+
+bool_t shrink_hash_table(hash_table_t *table) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return false;
+  }
+
+  size_t capacity = get_capacity_for_count(table->count);
+  if (capacity < DEFAULT_HASH_TABLE_SIZE)
+    capacity = DEFAULT_HASH_TABLE_SIZE;
+  if (capacity == table->capacity && table->migration_source == NULL &&
+      table->count_with_deleted == table->count) {
+    return true;
+  }
+  return rebuild_slots(table, capacity);
+}
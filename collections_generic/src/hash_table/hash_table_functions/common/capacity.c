@@ -0,0 +1,8 @@
+#include "capacity.h"
+
+size_t get_capacity_for_count(size_t count) {
+  size_t capacity = HASH_TABLE_GROUP_SIZE;
+  while (count > capacity * REHASH_THRESHOLD)
+    capacity *= RESIZE_FACTOR;
+  return capacity;
+}
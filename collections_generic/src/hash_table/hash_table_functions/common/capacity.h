@@ -0,0 +1,15 @@
+#ifndef CAPACITY_H
+#define CAPACITY_H
+
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Returns the smallest capacity holding `count` entries without
+ * growing.
+ *
+ * @details The capacity is a power of two of at least
+ * `HASH_TABLE_GROUP_SIZE` and keeps the load at or under `REHASH_THRESHOLD`.
+ */
+size_t get_capacity_for_count(size_t count);
+
+#endif
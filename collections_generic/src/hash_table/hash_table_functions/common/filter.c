@@ -0,0 +1,45 @@
+#include "filter.h"
+#include "../../../bloom_filter/bloom_filter.h"
+
+static void add_slot_hashes(bloom_filter_t *filter,
+                            const hash_table_t *table) {
+  for (size_t i = 0; i < table->capacity; i++) {
+    if (IS_SLOT_OCCUPIED(table->controls[i]))
+      add_hash_to_bloom_filter(filter, table->hashes[i]);
+  }
+}
+
+static void add_table_hashes(bloom_filter_t *filter,
+                             const hash_table_t *table) {
+  add_slot_hashes(filter, table);
+  if (table->migration_source != NULL)
+    add_slot_hashes(filter, table->migration_source);
+}
+
+bloom_filter_t *create_table_filter(const hash_table_t *table) {
+  // sized for the entries the table holds before its next resize
+  size_t expected_count = (size_t)(table->capacity * REHASH_THRESHOLD);
+  if (expected_count < table->count)
+    expected_count = table->count;
+  bloom_filter_t *filter = create_bloom_filter(
+      expected_count, HASH_TABLE_FILTER_FALSE_POSITIVE_RATE,
+      table->key_manager.size_of_obj, table->get_hash_code);
+  if (filter != NULL)
+    add_table_hashes(filter, table);
+  return filter;
+}
+
+void rebuild_filter(hash_table_t *table) {
+  if (table->filter == NULL)
+    return;
+
+  bloom_filter_t *filter = create_table_filter(table);
+  if (filter == NULL) {
+    // the old filter stays, it only gains false positives from stale and
+    // changed hashes
+    add_table_hashes(table->filter, table);
+    return;
+  }
+  destruct_bloom_filter(table->filter);
+  table->filter = filter;
+}
@@ -0,0 +1,48 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#include "../../../bloom_filter/bloom_filter_functions/base/bloom_filter_hash.h"
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Creates a Bloom filter of the stored hashes of the table, sized for
+ * its current capacity.
+ *
+ * @return The filter, or NULL on allocation failure.
+ */
+bloom_filter_t *create_table_filter(const hash_table_t *table);
+
+/**
+ * @brief Refills the Bloom filter of the table from its stored hashes, sized
+ * for the current capacity.
+ *
+ * @details Called whenever the stored hashes move or change: after a rebuild
+ * of the slots and at the end of an incremental resize. Also called once the
+ * filter holds many hashes of removed keys, which it cannot forget. Does
+ * nothing for a table without a filter. On allocation failure the current
+ * hashes are added to the old filter instead, which keeps it correct at the
+ * cost of more false positives.
+ */
+void rebuild_filter(hash_table_t *table);
+
+/**
+ * @brief Checks the Bloom filter of the table before probing for a hash.
+ *
+ * @return False if no stored key has the hash, true if one may have it or if
+ * the table has no filter.
+ */
+static inline bool_t filter_may_contain(const hash_table_t *table,
+                                        size_t hash) {
+  return table->filter == NULL ||
+         contains_hash_in_bloom_filter(table->filter, hash);
+}
+
+/**
+ * @brief Records a hash just stored in the table in its Bloom filter, if any.
+ */
+static inline void add_to_filter(hash_table_t *table, size_t hash) {
+  if (table->filter != NULL)
+    add_hash_to_bloom_filter(table->filter, hash);
+}
+
+#endif
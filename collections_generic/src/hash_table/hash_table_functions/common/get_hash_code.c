@@ -2,26 +2,28 @@
 
 #include "../../../support/validators.h"
 #include "hash.h"
-static size_t get_user_hash_code_or_default(const hash_table_t *table,
-                                            size_t key_gen, const void *key) {
-  if (NULL_ARGUMENT_CHECK(key) || NULL_ARGUMENT_CHECK(table)) {
-    return 0;
+
+size_t get_seeded_key_hash_code(get_hash_code_t get_hash_code, size_t seed,
+                                size_t key_size, const void *key) {
+  if (get_hash_code != NULL) {
+    // an odd key generator keeps multiplicative user hashes invertible
+    size_t key_gen = seed != 0 ? (seed | 1) : HASH_TABLE_KEY_GEN;
+    return (size_t)mix_hash_code(get_hash_code(SIZE_MAX, key_gen, key) ^
+                                 seed);
   }
+  return (size_t)hash_bytes(key, key_size, seed);
+}
 
-  size_t hash = 0;
+size_t get_key_hash_code(get_hash_code_t get_hash_code, size_t key_size,
+                         const void *key) {
+  return get_seeded_key_hash_code(get_hash_code, 0, key_size, key);
+}
 
-  if (table->get_hash_code != NULL) {
-    hash = table->get_hash_code(table->capacity, key_gen, key);
-  } else {
-    hash = get_hash_code_default(table->capacity, key_gen, key,
-                                 table->key_manager.size_of_obj);
+size_t get_full_hash_code(const hash_table_t *table, const void *key) {
+  if (NULL_ARGUMENT_CHECK(key) || NULL_ARGUMENT_CHECK(table)) {
+    return 0;
   }
-  return hash;
-}
 
-size_t get_hash_code_1(const hash_table_t *table, const void *key) {
-  return get_user_hash_code_or_default(table, table->capacity + 1, key);
+  return get_seeded_key_hash_code(table->get_hash_code, table->hash_seed,
+                                  table->key_manager.size_of_obj, key);
 }
-size_t get_hash_code_2(const hash_table_t *table, const void *key) {
-  return get_user_hash_code_or_default(table, table->capacity - 1, key);
-}
\ No newline at end of file
@@ -1,38 +1,58 @@
 #ifndef GET_HASH_CODE_OR_USE_DEFAULT_H
 #define GET_HASH_CODE_OR_USE_DEFAULT_H
 #include "../../types/hash_table.h"
+
+/**
+ * @brief Key generator passed to user `get_hash_code` functions of unseeded
+ * tables. Seeded tables pass their seed, made odd, instead.
+ */
+#define HASH_TABLE_KEY_GEN 31
+
 /**
- * @brief Computes a hash function for a given key and hash table capacity.
+ * @brief Computes the full-width hash code of a key.
  *
- * @param capacity The capacity of the hash table.
- * @param get_size_of_key Pointer to a function that returns the size of the
- * key.
+ * @param table The hash table the key belongs to.
  * @param key Pointer to the key.
- * @return The computed hash value.
- *
- * The function computes a hash function for a given key and hash table
- * capacity. This function simply calls Hash() with the appropriate arguments.
- *
- * @note The returned value may be greater than the hash table capacity.
- *
+ * @return The hash code, spread over all bits of `size_t`.
+ *
+ * The hash is computed once per operation: the probe position is the hash
+ * masked to the table capacity and the slot fingerprint is taken from its
+ * high bits. Without a user `get_hash_code`, the key bytes are hashed with
+ * `hash_bytes`. A user `get_hash_code` is called with `SIZE_MAX` as the
+ * capacity, so that it does not reduce the hash, and its result is mixed with
+ * `mix_hash_code`. Both are keyed by `hash_table_t::hash_seed`: the seed is
+ * the seed of `hash_bytes`, and the `key_gen` given to the user function,
+ * which should use it as the multiplier or seed of its hash.
+ *
+ * The seed is also XORed into the result of a user function before mixing,
+ * but equal results stay equal. Keys colliding in a user function that
+ * ignores `key_gen` therefore still collide after a reseed, and reseeding on
+ * long probes, see `HASH_TABLE_LONG_PROBE`, rebuilds the table for nothing.
  */
-size_t get_hash_code_1(const hash_table_t *table, const void *key);
+size_t get_full_hash_code(const hash_table_t *table, const void *key);
 
 /**
- * @brief Computes a hash function for a given key and hash table capacity.
+ * @brief Computes the full-width hash code of a key like
+ * `get_full_hash_code` with the given seed, for containers other than
+ * `hash_table_t`.
  *
- * @param capacity The capacity of the hash table.
- * @param get_size_of_key Pointer to a function that returns the size of the
- * key.
+ * @param get_hash_code The user hash function, or NULL to hash the key bytes.
+ * @param seed The seed, 0 for the unseeded hash.
+ * @param key_size Size of the key in bytes.
  * @param key Pointer to the key.
- * @return The computed hash value.
- *
- * The function computes a hash function for a given key and hash table
- * capacity. This function simply calls Hash() with the appropriate arguments.
- *
- * @note The returned value may be greater than the hash table capacity.
+ */
+size_t get_seeded_key_hash_code(get_hash_code_t get_hash_code, size_t seed,
+                                size_t key_size, const void *key);
+
+/**
+ * @brief Computes the unseeded full-width hash code of a key like
+ * `get_full_hash_code`, for containers other than `hash_table_t`.
  *
+ * @param get_hash_code The user hash function, or NULL to hash the key bytes.
+ * @param key_size Size of the key in bytes.
+ * @param key Pointer to the key.
  */
-size_t get_hash_code_2(const hash_table_t *table, const void *key);
+size_t get_key_hash_code(get_hash_code_t get_hash_code, size_t key_size,
+                         const void *key);
 
-#endif
\ No newline at end of file
+#endif
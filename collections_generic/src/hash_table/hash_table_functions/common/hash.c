@@ -1,12 +1,81 @@
 #include "hash.h"
-#include <stdint.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+#define HASH_SECRET_0 0xa0761d6478bd642fULL
+#define HASH_SECRET_1 0xe7037ed1a0b428dbULL
+#define HASH_SECRET_2 0x8ebc6af09c88c6e3ULL
+
+static inline uint64_t multiply_and_fold(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t product = (__uint128_t)a * b;
+  return (uint64_t)product ^ (uint64_t)(product >> 64);
+#else
+  uint64_t a_high = a >> 32, a_low = (uint32_t)a;
+  uint64_t b_high = b >> 32, b_low = (uint32_t)b;
+  uint64_t high = a_high * b_high, low = a_low * b_low;
+  uint64_t middle_1 = a_high * b_low, middle_2 = a_low * b_high;
+  uint64_t carry = ((low >> 32) + (uint32_t)middle_1 + (uint32_t)middle_2) >> 32;
+  low += (middle_1 << 32) + (middle_2 << 32);
+  high += (middle_1 >> 32) + (middle_2 >> 32) + carry;
+  return low ^ high;
+#endif
+}
+
+static inline uint64_t read_word(const uint8_t *bytes) {
+  uint64_t word;
+  memcpy(&word, bytes, sizeof(word));
+  return word;
+}
+
+static inline uint64_t read_tail(const uint8_t *bytes, size_t size) {
+  uint64_t word = 0;
+  memcpy(&word, bytes, size);
+  return word;
+}
+
+uint64_t hash_bytes(const void *data, size_t size, uint64_t seed) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint64_t hash = seed ^ multiply_and_fold(seed ^ HASH_SECRET_0, HASH_SECRET_1);
+  size_t remaining = size;
+
+  // the running state enters both operands, so no key word alone can zero
+  // the product and discard it
+  for (; remaining >= 16; remaining -= 16, bytes += 16) {
+    hash = multiply_and_fold(read_word(bytes) ^ HASH_SECRET_1 ^ hash,
+                             read_word(bytes + 8) ^ HASH_SECRET_2 ^ hash);
+  }
+  if (remaining >= 8) {
+    hash = multiply_and_fold(read_word(bytes) ^ HASH_SECRET_1 ^ hash,
+                             hash ^ HASH_SECRET_2);
+    remaining -= 8;
+    bytes += 8;
+  }
+  if (remaining > 0) {
+    hash = multiply_and_fold(
+        read_tail(bytes, remaining) ^ HASH_SECRET_1 ^ hash,
+        hash ^ HASH_SECRET_0);
+  }
+
+  return multiply_and_fold(hash ^ HASH_SECRET_2, size ^ HASH_SECRET_1);
+}
 
 size_t get_hash_code_default(size_t capacity, size_t key_gen, const void* key, size_t key_size)
 {
-  size_t hash = 0;
-  const int8_t* data_bytes = (const int8_t*)key;
-  for (size_t i = 0; i < key_size; i++)
-    hash = (hash * key_gen + data_bytes[i]) % capacity;
-  hash = (hash * 2 + 1) % capacity;
-  return hash; 
-}
\ No newline at end of file
+  return (size_t)(hash_bytes(key, key_size, key_gen) % capacity);
+}
+
+uint64_t generate_hash_seed(void) {
+  static atomic_uint_fast64_t sequence;
+  struct timespec now;
+  clock_gettime(CLOCK_REALTIME, &now);
+
+  // the address of a local differs between runs with address randomization
+  uint64_t entropy = (uint64_t)(uintptr_t)&now ^
+                     ((uint64_t)now.tv_sec << 32) ^ (uint64_t)now.tv_nsec;
+  uint64_t count = atomic_fetch_add(&sequence, 1);
+  uint64_t seed = mix_hash_code(multiply_and_fold(
+      entropy ^ HASH_SECRET_0, (count + 1) * HASH_SECRET_1));
+  return seed != 0 ? seed : HASH_SECRET_2;
+}
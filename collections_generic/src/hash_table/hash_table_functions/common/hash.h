@@ -1,25 +1,61 @@
 #ifndef HASH_H
 #define HASH_H
 #include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Computes a 64-bit hash of a block of bytes.
+ *
+ * @param data Pointer to the bytes to hash.
+ * @param size Number of bytes to hash.
+ * @param seed Value mixed into the hash; different seeds give unrelated
+ * hashes.
+ * @return The computed hash value, spread over all 64 bits.
+ *
+ * The bytes are consumed 8 (and 16) at a time and each step is mixed with a
+ * 64x64->128-bit multiplication folded back to 64 bits, in the spirit of
+ * wyhash. There is no division anywhere in the loop.
+ */
+uint64_t hash_bytes(const void *data, size_t size, uint64_t seed);
+
+/**
+ * @brief Spreads the bits of a hash code that may have poor high or low bits.
+ *
+ * @details Inline, so that tables with an inlined hash function, see
+ * `DECLARE_HASH_TABLE`, pay no call for it.
+ *
+ * @param hash The hash code to mix.
+ * @return The mixed hash code.
+ */
+static inline uint64_t mix_hash_code(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb3fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * @brief Returns a fresh nonzero seed for `hash_bytes`.
+ *
+ * @details Seeds mix the clock, a stack address and a process-wide counter,
+ * so two tables or two runs get unrelated seeds and an attacker cannot
+ * precompute keys that collide. They are not meant for cryptography.
+ */
+uint64_t generate_hash_seed(void);
+
 /**
  * @brief Computes a hash value for a given key, key generator, and hash table
  * capacity.
  *
  * @param capacity The capacity of the hash table.
- * @param keygen The key generator value.
+ * @param keygen The key generator value, used as the seed of `hash_bytes`.
  * @param key Pointer to the key.
- * @param get_size_of_data Pointer to a function that returns the size of the data.
- * @return The computed hash value.
- *
- * The function computes a hash value for a given key, key generator value, and
- * hash table capacity. The hash value is computed using a variation of the djb2
- * algorithm.
- *
- * @see http://www.cse.yorku.ca/~oz/hash.html
- *
- * @note The returned value may be greater than the hash table capacity.
+ * @param key_size The size of the key.
+ * @return The computed hash value, reduced to be less than the capacity.
  */
 size_t get_hash_code_default(size_t capacity, size_t key_gen, const void* key, size_t key_size);
 #define DEFAULT_GET_HASH_CODE get_hash_code_default
 
-#endif
\ No newline at end of file
+#endif
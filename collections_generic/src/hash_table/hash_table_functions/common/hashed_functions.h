@@ -0,0 +1,33 @@
+#ifndef HASHED_FUNCTIONS_H
+#define HASHED_FUNCTIONS_H
+
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Variants of the hash table operations taking the hash code of the
+ * key, for containers that already hashed it, such as sharded tables.
+ *
+ * @details Each one works like the operation it is named after, with `hash`
+ * computed by `get_full_hash_code` for the table, so with its current seed.
+ */
+
+bool_t add_to_hash_table_with_hash(hash_table_t *table, const void *key,
+                                   size_t hash, const void *data);
+
+bool_t contains_key_with_hash(const hash_table_t *table, const void *key,
+                              size_t hash);
+
+bool_t change_in_hash_table_with_hash(hash_table_t *table, const void *key,
+                                      size_t hash, const void *data);
+
+bool_t get_from_hash_table_with_hash(const hash_table_t *table,
+                                     const void *key, size_t hash, void *data);
+
+bool_t remove_from_hash_table_with_hash(hash_table_t *table, const void *key,
+                                        size_t hash);
+
+void *upsert_in_hash_table_with_hash(hash_table_t *table, const void *key,
+                                     size_t hash, const void *value,
+                                     bool_t *inserted);
+
+#endif
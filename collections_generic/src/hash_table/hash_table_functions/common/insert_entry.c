@@ -0,0 +1,98 @@
+#include "insert_entry.h"
+#include "../../probe_functions/probe_functions.h"
+#include "../../slot_functions/slot_functions.h"
+#include "../base/base_functions.h"
+#include "filter.h"
+#include "get_hash_code.h"
+#include "hash.h"
+#include "migration.h"
+#include "read_only.h"
+#include "rebuild_slots.h"
+
+static bool_t is_long_probe(const hash_table_t *table, size_t index) {
+  size_t length = get_slot_probe_length(table, index) - 1;
+  if (table->probing == GROUP_PROBING)
+    length *= HASH_TABLE_GROUP_SIZE;
+  return length >= HASH_TABLE_LONG_PROBE;
+}
+
+static void prepare_for_insert(hash_table_t *table) {
+  if (table->long_probe_seen &&
+      table->count >= table->count_at_reseed * 2) {
+    // the keys likely collide on purpose, a new seed scatters them again
+    table->count_at_reseed = table->count;
+    reseed_slots(table, (size_t)generate_hash_seed());
+  } else if (table->migration_source != NULL) {
+    migrate_slots(table, HASH_TABLE_MIGRATION_STEP);
+  } else if (table->count > table->capacity * REHASH_THRESHOLD) {
+    if (!table->incremental_resize ||
+        !start_migration(table, table->capacity * RESIZE_FACTOR))
+      resize_hash_table(table);
+  } else if (table->count_with_deleted > table->count * RESIZE_FACTOR) {
+    re_hash_hash_table(table);
+  }
+}
+
+bool_t find_or_insert_entry(hash_table_t *table, const void *key, size_t hash,
+                            const void *value, hash_table_t **owner,
+                            size_t *index, bool_t *inserted) {
+  *inserted = false;
+  if (read_only_check(table)) {
+    return false;
+  }
+
+  size_t seed = table->hash_seed;
+  prepare_for_insert(table);
+  if (table->hash_seed != seed)
+    hash = get_full_hash_code(table, key);
+  return find_or_insert_entry_with_hash(table, key, hash, value, owner, index,
+                                        inserted);
+}
+
+bool_t find_or_insert_entry_with_hash(hash_table_t *table, const void *key,
+                                      size_t hash, const void *value,
+                                      hash_table_t **owner, size_t *index,
+                                      bool_t *inserted) {
+  *inserted = false;
+  if (read_only_check(table)) {
+    return false;
+  }
+
+  if (table->migration_source != NULL && filter_may_contain(table, hash) &&
+      find_key_slot(table->migration_source, key, hash, index)) {
+    *owner = table->migration_source;
+    return true;
+  }
+
+  uint8_t control;
+  if (!prepare_insert_slot(table, key, hash, index, &control)) {
+    if (*index < table->capacity) {
+      *owner = table;
+      return true;
+    }
+
+    // the probe sequence is exhausted without a free slot
+    if (!rebuild_slots(table, table->capacity * RESIZE_FACTOR)) {
+      return false;
+    }
+    return find_or_insert_entry_with_hash(table, key, hash, value, owner,
+                                          index, inserted);
+  }
+
+  bool_t was_empty = table->controls[*index] == SLOT_EMPTY;
+  if (!store_in_slot(table, *index, control, hash, key, value)) {
+    cancel_insert_slot(table, *index);
+    return false;
+  }
+  if (was_empty) {
+    table->count_with_deleted++;
+  }
+  if (is_long_probe(table, *index)) {
+    table->long_probe_seen = true;
+  }
+  add_to_filter(table, hash);
+  table->count++;
+  *owner = table;
+  *inserted = true;
+  return true;
+}
@@ -0,0 +1,42 @@
+#ifndef INSERT_ENTRY_H
+#define INSERT_ENTRY_H
+
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Finds the slot holding the given key, inserting the key with the
+ * given value if it is missing, in a single probe.
+ *
+ * @details Grows, rehashes or advances the migration of the table first,
+ * like every insertion. The key and the value are copied with the user
+ * `copy` only when a new entry is created.
+ *
+ * @param table A pointer to the hash table.
+ * @param key A pointer to the key to find or insert.
+ * @param hash The hash code of the key computed by `get_full_hash_code`. It
+ * is computed again if the table draws a new seed before the insertion.
+ * @param value A pointer to the value of a new entry, may be NULL.
+ * @param owner Receives `table` or `table->migration_source`, whichever holds
+ * the key.
+ * @param index Receives the index of the slot in `owner`.
+ * @param inserted Receives true if a new entry was created.
+ * @return True on success, false on allocation failure.
+ */
+bool_t find_or_insert_entry(hash_table_t *table, const void *key, size_t hash,
+                            const void *value, hash_table_t **owner,
+                            size_t *index, bool_t *inserted);
+
+/**
+ * @brief Works like `find_or_insert_entry` with the hash code of the key
+ * already computed by `get_full_hash_code`, and without the load checks done
+ * before every insertion.
+ *
+ * @details The table only grows if the probe sequence has no free slot left,
+ * so the caller is responsible for reserving enough capacity first.
+ */
+bool_t find_or_insert_entry_with_hash(hash_table_t *table, const void *key,
+                                      size_t hash, const void *value,
+                                      hash_table_t **owner, size_t *index,
+                                      bool_t *inserted);
+
+#endif
@@ -0,0 +1,104 @@
+#include "migration.h"
+#include "../../../support/validators.h"
+#include "../../probe_functions/probe_functions.h"
+#include "../../slot_functions/slot_functions.h"
+#include "filter.h"
+#include "get_hash_code.h"
+#include "read_only.h"
+#include "stats.h"
+#include "rebuild_slots.h"
+
+#include <stdlib.h>
+
+bool_t start_migration(hash_table_t *table, size_t capacity) {
+  if (read_only_check(table)) {
+    return false;
+  }
+
+  HASH_TABLE_STATS_START(start);
+  hash_table_t *source = calloc(1, sizeof(hash_table_t));
+  if (MALLOC_FAILURE_CHECK(source)) {
+    return false;
+  }
+
+  *source = *table;
+  if (!allocate_slots(table, capacity)) {
+    free(source);
+    return false;
+  }
+  table->capacity = capacity;
+  table->count_with_deleted = 0;
+  table->migration_source = source;
+  table->migrated_slots = 0;
+  HASH_TABLE_STATS_RECORD(table, resize, start);
+  return true;
+}
+
+static void end_migration(hash_table_t *table) {
+  free_slots(table->migration_source);
+  free(table->migration_source);
+  table->migration_source = NULL;
+  table->migrated_slots = 0;
+  rebuild_filter(table);
+}
+
+void migrate_slots(hash_table_t *table, size_t slot_count) {
+  hash_table_t *source = table->migration_source;
+  if (source == NULL)
+    return;
+
+  HASH_TABLE_STATS_START(start);
+  size_t end = table->migrated_slots + slot_count;
+  if (end > source->capacity)
+    end = source->capacity;
+
+  for (size_t i = table->migrated_slots; i < end; i++) {
+    if (!IS_SLOT_OCCUPIED(source->controls[i]))
+      continue;
+
+    if (!relocate_entry(source, i, table)) {
+      // the entry stays in the old slots, where lookups still find it
+      table->migrated_slots = i;
+      HASH_TABLE_STATS_ADD_TIME(table, resize, start);
+      return;
+    }
+
+    // a deleted mark keeps the probe sequences of the old slots intact
+    source->controls[i] = SLOT_DELETED;
+    source->count--;
+  }
+  table->migrated_slots = end;
+  HASH_TABLE_STATS_ADD_TIME(table, resize, start);
+
+  if (table->migrated_slots == source->capacity || source->count == 0)
+    end_migration(table);
+}
+
+void finish_migration(hash_table_t *table) {
+  if (table->migration_source != NULL)
+    migrate_slots(table, table->migration_source->capacity);
+}
+
+bool_t find_entry(const hash_table_t *table, const void *key,
+                  const hash_table_t **owner, size_t *index) {
+  return find_entry_with_hash(table, key, get_full_hash_code(table, key),
+                              owner, index);
+}
+
+bool_t find_entry_with_hash(const hash_table_t *table, const void *key,
+                            size_t hash, const hash_table_t **owner,
+                            size_t *index) {
+  if (!filter_may_contain(table, hash)) {
+    return false;
+  }
+  if (find_key_slot(table, key, hash, index)) {
+    *owner = table;
+    return true;
+  }
+  if (table->migration_source != NULL &&
+      find_key_slot(table->migration_source, key, hash, index)) {
+    *owner = table->migration_source;
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,56 @@
+#ifndef MIGRATION_H
+#define MIGRATION_H
+
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Starts an incremental resize of the table.
+ *
+ * @details The current slot arrays become `table->migration_source` and new
+ * empty arrays of the given capacity become the table slots. Entries are then
+ * moved over by `migrate_slots`, and lookups consult both arrays until the
+ * migration is over.
+ *
+ * @return True on success, false on allocation failure (the table is not
+ * modified in that case).
+ */
+bool_t start_migration(hash_table_t *table, size_t capacity);
+
+/**
+ * @brief Moves the entries of up to `slot_count` old slots into the table
+ * slots, and ends the migration once every old slot has been visited.
+ *
+ * @details Entries are relocated without calling the user `copy` or
+ * `destruct`. Does nothing if no migration is in progress.
+ */
+void migrate_slots(hash_table_t *table, size_t slot_count);
+
+/**
+ * @brief Moves every remaining entry and ends the migration in progress, if
+ * any.
+ */
+void finish_migration(hash_table_t *table);
+
+/**
+ * @brief Finds the slot holding the given key in the table slots or, during a
+ * migration, in the old slots.
+ *
+ * @param table A pointer to the hash table to search in.
+ * @param key A pointer to the key to search for.
+ * @param owner Receives `table` or `table->migration_source`, whichever holds
+ * the key.
+ * @param index Receives the index of the slot in `owner`.
+ * @return True if the key is found, false otherwise.
+ */
+bool_t find_entry(const hash_table_t *table, const void *key,
+                  const hash_table_t **owner, size_t *index);
+
+/**
+ * @brief Works like `find_entry` with the hash code of the key already
+ * computed by `get_full_hash_code`.
+ */
+bool_t find_entry_with_hash(const hash_table_t *table, const void *key,
+                            size_t hash, const hash_table_t **owner,
+                            size_t *index);
+
+#endif
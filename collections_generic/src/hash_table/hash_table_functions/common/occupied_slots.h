@@ -0,0 +1,38 @@
+#ifndef OCCUPIED_SLOTS_H
+#define OCCUPIED_SLOTS_H
+
+#include "../../probe_functions/control_group.h"
+
+/**
+ * @brief Returns the first occupied slot at or after `index`, or the
+ * capacity if there is none.
+ *
+ * @details Control bytes are matched a group at a time, so runs of empty and
+ * deleted slots are skipped without visiting each slot.
+ */
+static inline size_t next_occupied_slot(const hash_table_t *table,
+                                        size_t index) {
+  while (index < table->capacity) {
+    size_t group = index & ~(size_t)(HASH_TABLE_GROUP_SIZE - 1);
+    group_mask_t mask =
+        match_occupied(table->controls + group) >> (index - group);
+    if (mask != 0)
+      return index + lowest_bit(mask);
+    index = group + HASH_TABLE_GROUP_SIZE;
+  }
+  return table->capacity;
+}
+
+/**
+ * @brief Returns the number of consecutive occupied slots starting at the
+ * occupied slot `index`, within its group.
+ */
+static inline size_t occupied_run_length(const hash_table_t *table,
+                                         size_t index) {
+  size_t group = index & ~(size_t)(HASH_TABLE_GROUP_SIZE - 1);
+  group_mask_t mask = match_occupied(table->controls + group) >> (index - group);
+  // the slots of the group past its end read as free
+  return (size_t)lowest_bit(~mask);
+}
+
+#endif
@@ -0,0 +1,111 @@
+#include "parallel_rebuild.h"
+#include "../../probe_functions/probe_functions.h"
+#include "../../slot_functions/slot_functions.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief The old slots moved by one thread.
+ */
+typedef struct rebuild_part_t {
+  hash_table_t *source; /**< The old slots. */
+  hash_table_t *target; /**< The new slots. */
+  size_t begin;         /**< First old slot of the part. */
+  size_t end;           /**< Old slot after the part. */
+  size_t moved;         /**< Receives the number of entries moved. */
+  bool_t failed;        /**< Set if an entry found no empty slot. */
+} rebuild_part_t;
+
+static void *relocate_part(void *argument) {
+  rebuild_part_t *part = argument;
+  hash_table_t *source = part->source;
+  hash_table_t *target = part->target;
+  size_t key_size = target->key_manager.size_of_obj;
+  size_t value_size = target->value_manager.size_of_obj;
+
+  for (size_t i = part->begin; i < part->end; i++) {
+    if (!IS_SLOT_OCCUPIED(source->controls[i]))
+      continue;
+
+    size_t to = claim_empty_slot(target, source->hashes[i]);
+    if (to == target->capacity) {
+      part->failed = true;
+      return NULL;
+    }
+    if (target->storage == FLAT_STORAGE) {
+      memcpy(get_slot_key(target, to), get_slot_key(source, i), key_size);
+      memcpy(get_slot_value(target, to), get_slot_value(source, i),
+             value_size);
+    } else {
+      // the old slots are left untouched, so they stay valid on failure
+      target->nodes[to] = source->nodes[i];
+    }
+    target->hashes[to] = source->hashes[i];
+    part->moved++;
+  }
+  return NULL;
+}
+
+bool_t relocate_entries_in_parallel(hash_table_t *source,
+                                    hash_table_t *target) {
+#if defined(__GNUC__)
+  size_t thread_count = target->resize_threads;
+  if (thread_count < 2 || target->probing != GROUP_PROBING ||
+      source->capacity < HASH_TABLE_PARALLEL_RESIZE_MIN)
+    return false;
+
+  rebuild_part_t *parts = calloc(thread_count, sizeof(rebuild_part_t));
+  pthread_t *threads = calloc(thread_count, sizeof(pthread_t));
+  bool_t *started = calloc(thread_count, sizeof(bool_t));
+  if (parts == NULL || threads == NULL || started == NULL) {
+    free(parts);
+    free(threads);
+    free(started);
+    return false;
+  }
+
+  size_t part_size = source->capacity / thread_count;
+  for (size_t i = 0; i < thread_count; i++) {
+    parts[i].source = source;
+    parts[i].target = target;
+    parts[i].begin = i * part_size;
+    parts[i].end =
+        i + 1 == thread_count ? source->capacity : (i + 1) * part_size;
+  }
+
+  // the calling thread moves the first part, and any part left without a
+  // thread
+  for (size_t i = 1; i < thread_count; i++)
+    started[i] =
+        pthread_create(&threads[i], NULL, relocate_part, &parts[i]) == 0;
+  relocate_part(&parts[0]);
+  for (size_t i = 1; i < thread_count; i++) {
+    if (started[i])
+      pthread_join(threads[i], NULL);
+    else
+      relocate_part(&parts[i]);
+  }
+
+  bool_t failed = false;
+  for (size_t i = 0; i < thread_count; i++) {
+    failed = failed || parts[i].failed;
+    target->count_with_deleted += parts[i].moved;
+  }
+  free(started);
+  free(parts);
+  free(threads);
+  if (failed) {
+    // the new slots are emptied again for the serial path
+    memset(target->controls, SLOT_EMPTY, target->capacity);
+    target->count_with_deleted = 0;
+    return false;
+  }
+  return true;
+#else
+  (void)source;
+  (void)target;
+  return false;
+#endif
+}
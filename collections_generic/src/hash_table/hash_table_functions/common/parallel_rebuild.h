@@ -0,0 +1,30 @@
+#ifndef PARALLEL_REBUILD_H
+#define PARALLEL_REBUILD_H
+
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Moves every live entry of `source` into the empty slots of `target`
+ * with `target->resize_threads` threads.
+ *
+ * @details The old slots are split into equal ranges, one per thread, and
+ * every thread claims new slots with `claim_empty_slot`, so no lock is taken
+ * and threads only contend on slots of the same group. Entries are relocated
+ * without calling the user `copy` or `destruct`; `target->count_with_deleted`
+ * is updated, `target->count` is not.
+ *
+ * The old slots are only read. If an entry finds no empty slot, the new
+ * slots are emptied again and false is returned, so the caller can move the
+ * entries itself.
+ *
+ * Nothing is moved if the table has fewer than two resize threads, uses
+ * Robin Hood probing (whose insertions shift other entries), has fewer than
+ * `HASH_TABLE_PARALLEL_RESIZE_MIN` old slots or if atomics are unavailable.
+ *
+ * @return True if the entries were moved, false if the caller has to move
+ * them itself.
+ */
+bool_t relocate_entries_in_parallel(hash_table_t *source,
+                                    hash_table_t *target);
+
+#endif
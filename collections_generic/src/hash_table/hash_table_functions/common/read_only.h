@@ -0,0 +1,24 @@
+#ifndef READ_ONLY_H
+#define READ_ONLY_H
+
+#include "../../../support/error.h"
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Reports an attempt to modify a table opened from a snapshot.
+ *
+ * @details The slot arrays of such a table live in a read-only file mapping,
+ * so every function adding, changing, removing or moving entries checks the
+ * table first.
+ *
+ * @return True if the table is read-only, false otherwise.
+ */
+static inline bool_t read_only_check(const hash_table_t *table) {
+  if (table->mapping == NULL)
+    return false;
+
+  ERROR_MESSAGE("The hash table is a read-only snapshot.");
+  return true;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#include "rebuild_slots.h"
+#include "../../probe_functions/probe_functions.h"
+#include "../../slot_functions/slot_functions.h"
+#include "filter.h"
+#include "get_hash_code.h"
+#include "migration.h"
+#include "parallel_rebuild.h"
+#include "read_only.h"
+#include "stats.h"
+
+bool_t relocate_entry(hash_table_t *source, size_t from,
+                      hash_table_t *target) {
+  size_t index;
+  uint8_t control;
+  // the stored hash code is reused, keys are not hashed again
+  if (!prepare_insert_slot(target, get_slot_key(source, from),
+                           source->hashes[from], &index, &control)) {
+    // the key is never present, so the probe sequence is exhausted
+    return false;
+  }
+  if (target->controls[index] == SLOT_EMPTY)
+    target->count_with_deleted++;
+  transfer_slot(source, from, target, index);
+  target->controls[index] = control;
+  return true;
+}
+
+bool_t rebuild_slots(hash_table_t *table, size_t capacity) {
+  if (read_only_check(table)) {
+    return false;
+  }
+
+  finish_migration(table);
+  if (table->migration_source != NULL) {
+    return false;
+  }
+
+  HASH_TABLE_STATS_START(start);
+  hash_table_t old = *table;
+  if (!allocate_slots(table, capacity)) {
+    return false;
+  }
+  table->capacity = capacity;
+  table->count_with_deleted = 0;
+  table->long_probe_seen = false;
+
+  // move entries to the new arrays, they keep their key and value memory
+  if (!relocate_entries_in_parallel(&old, table)) {
+    for (size_t i = 0; i < old.capacity; i++) {
+      if (IS_SLOT_OCCUPIED(old.controls[i]) &&
+          !relocate_entry(&old, i, table)) {
+        // the old slots were only read, the table goes back to them
+        free_slots(table);
+        *table = old;
+        return false;
+      }
+    }
+  }
+  free_slots(&old);
+  rebuild_filter(table);
+  if (capacity > old.capacity)
+    HASH_TABLE_STATS_RECORD(table, resize, start);
+  else
+    HASH_TABLE_STATS_RECORD(table, rehash, start);
+  return true;
+}
+
+static void set_slot_hashes(hash_table_t *table, size_t seed) {
+  table->hash_seed = seed;
+  for (size_t i = 0; i < table->capacity; i++) {
+    if (IS_SLOT_OCCUPIED(table->controls[i]))
+      table->hashes[i] = get_full_hash_code(table, get_slot_key(table, i));
+  }
+}
+
+bool_t reseed_slots(hash_table_t *table, size_t seed) {
+  if (read_only_check(table)) {
+    return false;
+  }
+
+  finish_migration(table);
+  size_t previous = table->hash_seed;
+  set_slot_hashes(table, seed);
+  if (!rebuild_slots(table, table->capacity)) {
+    // the old slots are kept, so are their positions for the old seed
+    set_slot_hashes(table, previous);
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,50 @@
+#ifndef REBUILD_SLOTS_H
+#define REBUILD_SLOTS_H
+
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Moves the entry of an occupied slot into the slots of `target`.
+ *
+ * @details The key must not be present in `target`. The entry is relocated
+ * without calling the user `copy` or `destruct`; `target->count` is not
+ * updated. The source slot keeps its stale contents and control byte.
+ *
+ * @return True on success, false if the probe sequence of the key in
+ * `target` has no free slot left (nothing is moved in that case).
+ */
+bool_t relocate_entry(hash_table_t *source, size_t from,
+                      hash_table_t *target);
+
+/**
+ * @brief Moves all entries of the table into new slot arrays.
+ *
+ * @details Allocates slot arrays of the given capacity according to the
+ * current `storage` and `probing` of the table, relocates every live entry
+ * into them with `relocate_entry` and frees the old arrays. Deleted slots are
+ * dropped on the way. No user `copy` or `destruct` is called.
+ *
+ * @param table A pointer to the hash table to rebuild.
+ * @param capacity The new capacity, a power of two of at least
+ * `HASH_TABLE_GROUP_SIZE`.
+ * @return True on success, false on allocation failure, if an entry finds
+ * no free slot in the new arrays or if a migration cannot be finished (the
+ * table keeps its old slots in that case).
+ */
+bool_t rebuild_slots(hash_table_t *table, size_t capacity);
+
+/**
+ * @brief Hashes every key again with a new seed and moves the entries to
+ * their new positions.
+ *
+ * @details Keys are hashed once each; the user `copy` and `destruct` are not
+ * called.
+ *
+ * @param table A pointer to the hash table.
+ * @param seed The new `hash_seed`.
+ * @return True on success, false on allocation failure (the table keeps its
+ * old seed and slots in that case).
+ */
+bool_t reseed_slots(hash_table_t *table, size_t seed);
+
+#endif
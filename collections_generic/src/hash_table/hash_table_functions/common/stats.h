@@ -0,0 +1,43 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "../../types/hash_table.h"
+
+#ifdef HASH_TABLE_STATS
+#include <time.h>
+
+static inline uint64_t get_stats_clock(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Starts timing a resize or rehash of a table.
+ */
+#define HASH_TABLE_STATS_START(start) uint64_t start = get_stats_clock()
+
+/**
+ * @brief Counts a resize or rehash of a table and adds the time elapsed since
+ * `HASH_TABLE_STATS_START`. `kind` is `resize` or `rehash`.
+ */
+#define HASH_TABLE_STATS_RECORD(table, kind, start)                            \
+  do {                                                                         \
+    (table)->counters.kind##_count++;                                          \
+    (table)->counters.kind##_nanoseconds += get_stats_clock() - (start);       \
+  } while (0)
+
+/**
+ * @brief Adds the time elapsed since `HASH_TABLE_STATS_START` to a resize or
+ * rehash of a table without counting a new one.
+ */
+#define HASH_TABLE_STATS_ADD_TIME(table, kind, start)                          \
+  ((table)->counters.kind##_nanoseconds += get_stats_clock() - (start))
+
+#else
+#define HASH_TABLE_STATS_START(start)
+#define HASH_TABLE_STATS_RECORD(table, kind, start) ((void)0)
+#define HASH_TABLE_STATS_ADD_TIME(table, kind, start) ((void)0)
+#endif
+
+#endif
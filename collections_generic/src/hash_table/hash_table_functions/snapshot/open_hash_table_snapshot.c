@@ -0,0 +1,99 @@
+#include "../../../support/error.h"
+#include "../../../support/validators.h"
+#include "snapshot_format.h"
+#include "snapshot_functions.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static bool_t is_valid_snapshot(const hash_table_snapshot_header_t *header,
+                                uint64_t file_size, bool_t user_hash) {
+  if (header->magic != HASH_TABLE_SNAPSHOT_MAGIC ||
+      header->version != HASH_TABLE_SNAPSHOT_VERSION ||
+      header->word_size != sizeof(size_t) ||
+      header->byte_order != HASH_TABLE_SNAPSHOT_BYTE_ORDER ||
+      header->user_hash != (uint32_t)user_hash ||
+      (header->probing != GROUP_PROBING &&
+       header->probing != ROBIN_HOOD_PROBING))
+    return false;
+
+  // the capacity and sizes bound the array sizes before they are multiplied
+  uint64_t capacity = header->capacity;
+  if (capacity < HASH_TABLE_GROUP_SIZE || (capacity & (capacity - 1)) != 0 ||
+      capacity > file_size || header->count > header->count_with_deleted ||
+      header->count_with_deleted > capacity ||
+      header->key_size > file_size / capacity ||
+      header->value_size > file_size / capacity)
+    return false;
+
+  hash_table_snapshot_header_t expected = *header;
+  layout_snapshot(&expected);
+  return memcmp(&expected, header, sizeof(expected)) == 0 &&
+         expected.file_size <= file_size;
+}
+
+hash_table_t *open_hash_table_snapshot(const char *path, compare_t key_compare,
+                                       compare_t value_compare,
+                                       get_hash_code_t get_hash_code) {
+  if (NULL_ARGUMENT_CHECK(path) || NULL_ARGUMENT_CHECK(key_compare)) {
+    return NULL;
+  }
+
+  int file = open(path, O_RDONLY);
+  if (file < 0) {
+    ERROR_MESSAGE("Cannot open the snapshot file.");
+    return NULL;
+  }
+  struct stat status;
+  void *mapping = MAP_FAILED;
+  size_t mapping_size = 0;
+  if (fstat(file, &status) == 0 &&
+      (uint64_t)status.st_size >= sizeof(hash_table_snapshot_header_t)) {
+    mapping_size = (size_t)status.st_size;
+    mapping = mmap(NULL, mapping_size, PROT_READ, MAP_PRIVATE, file, 0);
+  }
+  close(file);
+  if (mapping == MAP_FAILED) {
+    ERROR_MESSAGE("Cannot map the snapshot file.");
+    return NULL;
+  }
+
+  const hash_table_snapshot_header_t *header = mapping;
+  if (!is_valid_snapshot(header, mapping_size, get_hash_code != NULL)) {
+    ERROR_MESSAGE("The file is not a valid hash table snapshot.");
+    munmap(mapping, mapping_size);
+    return NULL;
+  }
+
+  hash_table_t *table = calloc(1, sizeof(hash_table_t));
+  if (MALLOC_FAILURE_CHECK(table)) {
+    munmap(mapping, mapping_size);
+    return NULL;
+  }
+
+  char *bytes = mapping;
+  type_manager_t keys = {header->key_size, .compare = key_compare};
+  table->key_manager = keys;
+  type_manager_t values = {header->value_size, .compare = value_compare};
+  table->value_manager = values;
+  table->storage = FLAT_STORAGE;
+  table->probing = (hash_table_probing_t)header->probing;
+  table->capacity = header->capacity;
+  table->count = header->count;
+  table->count_with_deleted = header->count_with_deleted;
+  table->controls = (uint8_t *)(bytes + header->controls_offset);
+  table->hashes = (size_t *)(bytes + header->hashes_offset);
+  if (header->distances_offset != 0)
+    table->distances = (uint32_t *)(bytes + header->distances_offset);
+  table->keys = bytes + header->keys_offset;
+  table->values = bytes + header->values_offset;
+  table->get_hash_code = get_hash_code;
+  table->hash_seed = (size_t)header->hash_seed;
+  table->mapping = mapping;
+  table->mapping_size = mapping_size;
+  return table;
+}
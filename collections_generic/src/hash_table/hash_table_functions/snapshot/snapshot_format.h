@@ -0,0 +1,74 @@
+#ifndef SNAPSHOT_FORMAT_H
+#define SNAPSHOT_FORMAT_H
+
+#include <stdint.h>
+
+#include "../../types/hash_table.h"
+
+#define HASH_TABLE_SNAPSHOT_MAGIC 0x5041534854474843ULL /* "CGHTSNAP" */
+/* 2: stored hashes of keys without a user hash come from the hash_bytes
+   that mixes its state into both multiplication operands */
+#define HASH_TABLE_SNAPSHOT_VERSION 2
+#define HASH_TABLE_SNAPSHOT_BYTE_ORDER 0x0102030405060708ULL
+
+/**
+ * @brief Alignment of every array in a snapshot file, enough for the stored
+ * hash codes and for group loads of the control bytes.
+ */
+#define HASH_TABLE_SNAPSHOT_ALIGNMENT 64
+
+/**
+ * @brief Header at the start of a snapshot file.
+ *
+ * @details All fields have fixed sizes and every array is located by its
+ * offset from the start of the file.
+ */
+typedef struct hash_table_snapshot_header_t {
+  uint64_t magic;           /**< HASH_TABLE_SNAPSHOT_MAGIC. */
+  uint32_t version;         /**< HASH_TABLE_SNAPSHOT_VERSION. */
+  uint32_t word_size;       /**< sizeof(size_t) of the writer. */
+  uint64_t byte_order;      /**< HASH_TABLE_SNAPSHOT_BYTE_ORDER as written. */
+  uint64_t key_size;        /**< Size of a key. */
+  uint64_t value_size;      /**< Size of a value. */
+  uint64_t capacity;        /**< Number of slots. */
+  uint64_t count;           /**< Number of entries. */
+  uint64_t count_with_deleted; /**< Number of entries and deleted slots. */
+  uint32_t probing;         /**< hash_table_probing_t of the table. */
+  uint32_t user_hash;       /**< Whether keys were hashed by get_hash_code. */
+  uint64_t hash_seed;       /**< Seed of the stored hash codes. */
+  uint64_t controls_offset; /**< Offset of the control bytes. */
+  uint64_t hashes_offset;   /**< Offset of the stored hash codes. */
+  uint64_t distances_offset; /**< Offset of the distances, 0 if none. */
+  uint64_t keys_offset;     /**< Offset of the keys. */
+  uint64_t values_offset;   /**< Offset of the values. */
+  uint64_t file_size;       /**< Size of the whole file. */
+} hash_table_snapshot_header_t;
+
+static inline uint64_t align_snapshot_offset(uint64_t offset) {
+  return (offset + HASH_TABLE_SNAPSHOT_ALIGNMENT - 1) &
+         ~(uint64_t)(HASH_TABLE_SNAPSHOT_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Fills the array offsets and the file size of a header whose sizes,
+ * capacity and probing are already set.
+ */
+static inline void layout_snapshot(hash_table_snapshot_header_t *header) {
+  uint64_t offset = align_snapshot_offset(sizeof(*header));
+  header->controls_offset = offset;
+  offset = align_snapshot_offset(offset + header->capacity);
+  header->hashes_offset = offset;
+  offset = align_snapshot_offset(offset + header->capacity * sizeof(size_t));
+  header->distances_offset = 0;
+  if (header->probing == ROBIN_HOOD_PROBING) {
+    header->distances_offset = offset;
+    offset =
+        align_snapshot_offset(offset + header->capacity * sizeof(uint32_t));
+  }
+  header->keys_offset = offset;
+  offset = align_snapshot_offset(offset + header->capacity * header->key_size);
+  header->values_offset = offset;
+  header->file_size = offset + header->capacity * header->value_size;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef SNAPSHOT_FUNCTIONS_HASH_TABLE_H
+#define SNAPSHOT_FUNCTIONS_HASH_TABLE_H
+
+#include "../../types/hash_table.h"
+
+/**
+ * @brief Writes the slot arrays of a hash table to a file, so that the table
+ * can later be served straight from a mapping of that file.
+ *
+ * @details The file holds a header followed by the control bytes, stored hash
+ * codes, Robin Hood distances and the inline keys and values, each at an
+ * offset recorded in the header. Nothing in the file is a pointer, so a
+ * mapping works at any address. An incremental resize in progress is finished
+ * first.
+ *
+ * Only flat tables of trivially copyable keys and values can be written, that
+ * is tables without a user `copy` or `destruct`. The file can only be opened
+ * on a machine with the same word size and byte order.
+ *
+ * @param table A pointer to the hash table.
+ * @param path Path of the file to create or overwrite.
+ * @return True on success, false if the table cannot be written or on an I/O
+ * error.
+ */
+bool_t write_hash_table_snapshot(hash_table_t *table, const char *path);
+
+/**
+ * @brief Opens a file written by `write_hash_table_snapshot` as a read-only
+ * hash table.
+ *
+ * @details The file is mapped into memory and the slot arrays of the returned
+ * table point into the mapping, so opening neither allocates slot arrays nor
+ * hashes keys again, and pages are only read in as lookups touch them.
+ * `get_from_hash_table`, `contains_key`, `get_many_from_hash_table` and the
+ * other lookups work as usual, while every function modifying the table
+ * fails. Pointers returned by `get_pointer_from_hash_table` must not be
+ * written through. `destruct_hash_table` unmaps the file.
+ *
+ * @param path Path of the snapshot file.
+ * @param key_compare Function to compare keys, as given to `create_hash_table`.
+ * @param value_compare Function to compare values, may be NULL.
+ * @param get_hash_code The user hash function the table was written with, or
+ * NULL if it used the built-in hash.
+ * @return A pointer to the read-only table, or NULL if the file cannot be
+ * mapped or is not a valid snapshot.
+ */
+hash_table_t *open_hash_table_snapshot(const char *path, compare_t key_compare,
+                                       compare_t value_compare,
+                                       get_hash_code_t get_hash_code);
+
+#endif
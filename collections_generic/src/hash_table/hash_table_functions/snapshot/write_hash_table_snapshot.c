@@ -0,0 +1,79 @@
+#include "../../../support/error.h"
+#include "../../../support/validators.h"
+#include "../common/migration.h"
+#include "snapshot_format.h"
+#include "snapshot_functions.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static bool_t write_array(FILE *file, uint64_t offset, const void *data,
+                          uint64_t size) {
+  static const char padding[HASH_TABLE_SNAPSHOT_ALIGNMENT];
+  long position = ftell(file);
+  if (position < 0 || (uint64_t)position > offset)
+    return false;
+
+  for (uint64_t gap = offset - (uint64_t)position; gap > 0;) {
+    size_t chunk = gap < sizeof(padding) ? (size_t)gap : sizeof(padding);
+    if (fwrite(padding, 1, chunk, file) != chunk)
+      return false;
+    gap -= chunk;
+  }
+  return size == 0 || fwrite(data, 1, (size_t)size, file) == size;
+}
+
+bool_t write_hash_table_snapshot(hash_table_t *table, const char *path) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(path)) {
+    return false;
+  }
+  if (table->storage != FLAT_STORAGE || table->key_manager.copy != NULL ||
+      table->value_manager.copy != NULL) {
+    ERROR_MESSAGE("Only keys and values without copy or destruct can be "
+                  "written to a snapshot.");
+    return false;
+  }
+
+  finish_migration(table);
+
+  hash_table_snapshot_header_t header;
+  memset(&header, 0, sizeof(header));
+  header.magic = HASH_TABLE_SNAPSHOT_MAGIC;
+  header.version = HASH_TABLE_SNAPSHOT_VERSION;
+  header.word_size = sizeof(size_t);
+  header.byte_order = HASH_TABLE_SNAPSHOT_BYTE_ORDER;
+  header.key_size = table->key_manager.size_of_obj;
+  header.value_size = table->value_manager.size_of_obj;
+  header.capacity = table->capacity;
+  header.count = table->count;
+  header.count_with_deleted = table->count_with_deleted;
+  header.probing = table->probing;
+  header.user_hash = table->get_hash_code != NULL;
+  header.hash_seed = table->hash_seed;
+  layout_snapshot(&header);
+
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    ERROR_MESSAGE("Cannot create the snapshot file.");
+    return false;
+  }
+
+  uint64_t capacity = header.capacity;
+  bool_t success =
+      write_array(file, 0, &header, sizeof(header)) &&
+      write_array(file, header.controls_offset, table->controls, capacity) &&
+      write_array(file, header.hashes_offset, table->hashes,
+                  capacity * sizeof(size_t)) &&
+      (header.distances_offset == 0 ||
+       write_array(file, header.distances_offset, table->distances,
+                   capacity * sizeof(uint32_t))) &&
+      write_array(file, header.keys_offset, table->keys,
+                  capacity * header.key_size) &&
+      write_array(file, header.values_offset, table->values,
+                  capacity * header.value_size);
+  success = fclose(file) == 0 && success;
+  if (!success) {
+    ERROR_MESSAGE("Cannot write the snapshot file.");
+  }
+  return success;
+}
@@ -0,0 +1,53 @@
+#include "../../../support/validators.h"
+#include "../../probe_functions/probe_functions.h"
+#include "stats_functions.h"
+
+#include <string.h>
+
+static size_t add_probe_lengths(const hash_table_t *table,
+                                hash_table_stats_t *stats) {
+  size_t total = 0;
+  for (size_t i = 0; i < table->capacity; i++) {
+    if (!IS_SLOT_OCCUPIED(table->controls[i]))
+      continue;
+
+    size_t length = get_slot_probe_length(table, i);
+    size_t bucket = length <= HASH_TABLE_STATS_HISTOGRAM_SIZE
+                        ? length - 1
+                        : HASH_TABLE_STATS_HISTOGRAM_SIZE - 1;
+    stats->probe_length_histogram[bucket]++;
+    if (length > stats->max_probe_length)
+      stats->max_probe_length = length;
+    total += length;
+  }
+  return total;
+}
+
+bool_t hash_table_stats(const hash_table_t *table, hash_table_stats_t *stats) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(stats)) {
+    return false;
+  }
+
+  memset(stats, 0, sizeof(*stats));
+  stats->capacity = table->capacity;
+  stats->count = table->count;
+
+  size_t used_slots = table->count_with_deleted;
+  size_t total = add_probe_lengths(table, stats);
+  const hash_table_t *source = table->migration_source;
+  if (source != NULL) {
+    total += add_probe_lengths(source, stats);
+    stats->capacity += source->capacity;
+    used_slots += source->count_with_deleted;
+  }
+
+  // migrated entries leave deleted marks in the old slots until it is freed
+  stats->tombstones = used_slots - table->count;
+  stats->load_factor = (double)used_slots / (double)stats->capacity;
+  if (table->count != 0)
+    stats->mean_probe_length = (double)total / (double)table->count;
+#ifdef HASH_TABLE_STATS
+  stats->counters = table->counters;
+#endif
+  return true;
+}
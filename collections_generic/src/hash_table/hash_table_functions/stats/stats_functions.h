@@ -0,0 +1,23 @@
+#ifndef STATS_FUNCTIONS_HASH_TABLE_H
+#define STATS_FUNCTIONS_HASH_TABLE_H
+
+#include "../../types/hash_table.h"
+#include "../../types/hash_table_stats.h"
+
+/**
+ * @brief Summarizes the load, deleted slots and probe lengths of a hash
+ * table.
+ *
+ * @details Probe lengths are recomputed from the stored hash codes, so the
+ * call visits every slot but neither hashes keys nor calls `compare`. Entries
+ * still waiting in an incremental resize are counted with their old slots.
+ * The resize and rehash counters are only filled when the library is built
+ * with `HASH_TABLE_STATS` defined, and are zero otherwise.
+ *
+ * @param table A pointer to the hash table.
+ * @param stats Receives the summary.
+ * @return True on success, false if an argument is NULL.
+ */
+bool_t hash_table_stats(const hash_table_t *table, hash_table_stats_t *stats);
+
+#endif
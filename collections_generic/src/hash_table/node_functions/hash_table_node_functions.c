@@ -39,7 +39,6 @@ hash_table_node_t *create_hash_table_node(const type_manager_t *key_manager,
   } else {
     node->value = NULL;
   }
-  node->is_deleted = false;
 
   return node;
 }
@@ -0,0 +1,90 @@
+#ifndef CONTROL_GROUP_H
+#define CONTROL_GROUP_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../types/hash_table.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Bit mask with one bit per slot of a group of
+ * `HASH_TABLE_GROUP_SIZE` control bytes; bit `i` refers to slot `i`.
+ */
+typedef uint32_t group_mask_t;
+
+/**
+ * @brief Returns the mask of slots of the group whose control byte equals
+ * `control`.
+ */
+static inline group_mask_t match_control(const uint8_t *group,
+                                         uint8_t control) {
+#if defined(__SSE2__)
+  __m128i controls = _mm_loadu_si128((const __m128i *)group);
+  __m128i pattern = _mm_set1_epi8((char)control);
+  return (group_mask_t)_mm_movemask_epi8(_mm_cmpeq_epi8(controls, pattern));
+#else
+  group_mask_t mask = 0;
+  for (int i = 0; i < HASH_TABLE_GROUP_SIZE; i++) {
+    if (group[i] == control)
+      mask |= (group_mask_t)1 << i;
+  }
+  return mask;
+#endif
+}
+
+/**
+ * @brief Returns the mask of empty and deleted slots of the group.
+ */
+static inline group_mask_t match_free(const uint8_t *group) {
+#if defined(__SSE2__)
+  // Free control bytes are exactly those with the high bit set
+  return (group_mask_t)_mm_movemask_epi8(
+      _mm_loadu_si128((const __m128i *)group));
+#else
+  group_mask_t mask = 0;
+  for (int i = 0; i < HASH_TABLE_GROUP_SIZE; i++) {
+    if (!IS_SLOT_OCCUPIED(group[i]))
+      mask |= (group_mask_t)1 << i;
+  }
+  return mask;
+#endif
+}
+
+/**
+ * @brief Returns the mask of occupied slots of the group.
+ *
+ * @details Without SSE2, the control bytes are read eight at a time and the
+ * high bits of a word are gathered into one byte of mask by a multiplication.
+ */
+static inline group_mask_t match_occupied(const uint8_t *group) {
+#if defined(__SSE2__)
+  return ~match_free(group) & (((group_mask_t)1 << HASH_TABLE_GROUP_SIZE) - 1);
+#else
+  group_mask_t mask = 0;
+  for (int i = 0; i < HASH_TABLE_GROUP_SIZE; i += 8) {
+    uint64_t word;
+    memcpy(&word, group + i, sizeof(word));
+    uint64_t occupied = (~word & 0x8080808080808080ull) >> 7;
+    mask |= (group_mask_t)((occupied * 0x0102040810204080ull) >> 56) << i;
+  }
+  return mask;
+#endif
+}
+
+/**
+ * @brief Returns the mask of empty slots of the group.
+ */
+static inline group_mask_t match_empty(const uint8_t *group) {
+  return match_control(group, SLOT_EMPTY);
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero mask.
+ */
+static inline int lowest_bit(group_mask_t mask) { return __builtin_ctz(mask); }
+
+#endif
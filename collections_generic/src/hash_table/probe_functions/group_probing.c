@@ -0,0 +1,114 @@
+#include "../slot_functions/slot_functions.h"
+#include "control_group.h"
+#include "probing.h"
+
+static size_t get_group_count(const hash_table_t *table) {
+  return table->capacity / HASH_TABLE_GROUP_SIZE;
+}
+
+bool_t group_find_key_slot(const hash_table_t *table, const void *key,
+                           size_t hash, size_t *index) {
+  size_t group_count = get_group_count(table);
+  size_t index_mask = group_count - 1;
+  size_t group = hash & index_mask;
+  uint8_t fingerprint = get_fingerprint(hash);
+
+  for (size_t i = 0; i < group_count; i++) {
+    size_t first_slot = group * HASH_TABLE_GROUP_SIZE;
+    const uint8_t *controls = table->controls + first_slot;
+
+    for (group_mask_t hits = match_control(controls, fingerprint); hits != 0;
+         hits &= hits - 1) {
+      size_t slot = first_slot + lowest_bit(hits);
+      if (table->hashes[slot] == hash &&
+          table->key_manager.compare(get_slot_key(table, slot), key) == 0) {
+        *index = slot;
+        return true;
+      }
+    }
+    if (match_empty(controls) != 0)
+      return false;
+
+    // triangular steps visit every group of a power-of-two table once
+    group = (group + i + 1) & index_mask;
+  }
+  return false;
+}
+
+bool_t group_prepare_insert_slot(hash_table_t *table, const void *key,
+                                 size_t hash, size_t *index, uint8_t *control) {
+  size_t group_count = get_group_count(table);
+  size_t index_mask = group_count - 1;
+  size_t group = hash & index_mask;
+  uint8_t fingerprint = get_fingerprint(hash);
+
+  bool_t found_free = false;
+  size_t free_slot = table->capacity;
+  for (size_t i = 0; i < group_count; i++) {
+    size_t first_slot = group * HASH_TABLE_GROUP_SIZE;
+    const uint8_t *controls = table->controls + first_slot;
+
+    for (group_mask_t hits = match_control(controls, fingerprint); hits != 0;
+         hits &= hits - 1) {
+      size_t slot = first_slot + lowest_bit(hits);
+      if (table->hashes[slot] == hash &&
+          table->key_manager.compare(get_slot_key(table, slot), key) == 0) {
+        *index = slot;
+        return false;
+      }
+    }
+
+    group_mask_t free_mask = match_free(controls);
+    if (!found_free && free_mask != 0) {
+      free_slot = first_slot + lowest_bit(free_mask);
+      found_free = true;
+    }
+    if (match_empty(controls) != 0)
+      break;
+
+    // triangular steps visit every group of a power-of-two table once
+    group = (group + i + 1) & index_mask;
+  }
+
+  *index = free_slot;
+  *control = fingerprint;
+  return found_free;
+}
+
+void group_release_slot(hash_table_t *table, size_t index) {
+  const uint8_t *group =
+      table->controls + index / HASH_TABLE_GROUP_SIZE * HASH_TABLE_GROUP_SIZE;
+  if (match_empty(group) != 0) {
+    table->controls[index] = SLOT_EMPTY;
+    table->count_with_deleted--;
+  } else {
+    table->controls[index] = SLOT_DELETED;
+  }
+}
+
+size_t group_claim_empty_slot(hash_table_t *table, size_t hash) {
+#if defined(__GNUC__)
+  size_t group_count = get_group_count(table);
+  size_t index_mask = group_count - 1;
+  size_t group = hash & index_mask;
+  uint8_t fingerprint = get_fingerprint(hash);
+
+  for (size_t i = 0; i < group_count; i++) {
+    uint8_t *controls = table->controls + group * HASH_TABLE_GROUP_SIZE;
+    for (size_t slot = 0; slot < HASH_TABLE_GROUP_SIZE; slot++) {
+      uint8_t expected = SLOT_EMPTY;
+      if (__atomic_load_n(&controls[slot], __ATOMIC_RELAXED) == SLOT_EMPTY &&
+          __atomic_compare_exchange_n(&controls[slot], &expected, fingerprint,
+                                      false, __ATOMIC_RELAXED,
+                                      __ATOMIC_RELAXED))
+        return group * HASH_TABLE_GROUP_SIZE + slot;
+    }
+
+    // triangular steps visit every group of a power-of-two table once
+    group = (group + i + 1) & index_mask;
+  }
+#else
+  (void)hash;
+#endif
+  return table->capacity;
+}
@@ -0,0 +1,67 @@
+#include "probe_functions.h"
+#include "probing.h"
+
+bool_t find_key_slot(const hash_table_t *table, const void *key, size_t hash,
+                     size_t *index) {
+  if (table->probing == ROBIN_HOOD_PROBING)
+    return robin_hood_find_key_slot(table, key, hash, index);
+  return group_find_key_slot(table, key, hash, index);
+}
+
+void prefetch_key_slot(const hash_table_t *table, size_t hash) {
+#if defined(__GNUC__)
+  size_t slot = table->probing == ROBIN_HOOD_PROBING
+                    ? hash & (table->capacity - 1)
+                    : (hash & (table->capacity / HASH_TABLE_GROUP_SIZE - 1)) *
+                          HASH_TABLE_GROUP_SIZE;
+  __builtin_prefetch(table->controls + slot);
+  __builtin_prefetch(table->hashes + slot);
+#else
+  (void)table;
+  (void)hash;
+#endif
+}
+
+bool_t prepare_insert_slot(hash_table_t *table, const void *key, size_t hash,
+                           size_t *index, uint8_t *control) {
+  if (table->probing == ROBIN_HOOD_PROBING)
+    return robin_hood_prepare_insert_slot(table, key, hash, index, control);
+  return group_prepare_insert_slot(table, key, hash, index, control);
+}
+
+void cancel_insert_slot(hash_table_t *table, size_t index) {
+  if (table->probing == ROBIN_HOOD_PROBING)
+    robin_hood_cancel_insert_slot(table, index);
+}
+
+void release_slot(hash_table_t *table, size_t index) {
+  if (table->probing == ROBIN_HOOD_PROBING)
+    robin_hood_release_slot(table, index);
+  else
+    group_release_slot(table, index);
+}
+
+size_t claim_empty_slot(hash_table_t *table, size_t hash) {
+  return group_claim_empty_slot(table, hash);
+}
+
+static size_t get_group_probe_length(const hash_table_t *table, size_t index) {
+  size_t group_count = table->capacity / HASH_TABLE_GROUP_SIZE;
+  size_t index_mask = group_count - 1;
+  size_t group = table->hashes[index] & index_mask;
+  size_t target = index / HASH_TABLE_GROUP_SIZE;
+
+  // follows the triangular steps of group_find_key_slot
+  for (size_t i = 0; i < group_count; i++) {
+    if (group == target)
+      return i + 1;
+    group = (group + i + 1) & index_mask;
+  }
+  return group_count;
+}
+
+size_t get_slot_probe_length(const hash_table_t *table, size_t index) {
+  if (table->probing == ROBIN_HOOD_PROBING)
+    return (size_t)table->distances[index] + 1;
+  return get_group_probe_length(table, index);
+}
@@ -0,0 +1,102 @@
+#ifndef PROBE_FUNCTIONS_H
+#define PROBE_FUNCTIONS_H
+
+#include "../types/hash_table.h"
+
+/**
+ * @brief Finds the slot holding the given key.
+ *
+ * @details With group probing, slots are probed group by group starting from
+ * the group selected by the key hash. Within a group the fingerprints of all
+ * slots are matched at once and `key_manager.compare` is only called on
+ * fingerprint hits. The search stops at the first group that has an empty
+ * slot. With Robin Hood probing, slots are probed one by one from the home
+ * slot and the search stops at the first entry closer to its own home slot
+ * than the key would be.
+ *
+ * @param table A pointer to the hash table to search in.
+ * @param key A pointer to the key to search for.
+ * @param hash The hash code of the key, see `get_full_hash_code`.
+ * @param index Receives the index of the slot if the key is found.
+ * @return True if the key is found, false otherwise.
+ */
+bool_t find_key_slot(const hash_table_t *table, const void *key, size_t hash,
+                     size_t *index);
+
+/**
+ * @brief Prefetches the first slot probed for a key into the cache.
+ *
+ * @details Fetches the control bytes and the stored hash codes of the home
+ * group (group probing) or home slot (Robin Hood probing), so a later
+ * `find_key_slot` with the same hash does not stall on them. Does nothing on
+ * compilers without `__builtin_prefetch`.
+ */
+void prefetch_key_slot(const hash_table_t *table, size_t hash);
+
+/**
+ * @brief Finds and frees up the slot where the given key should be inserted.
+ *
+ * @details With group probing, probes like `find_key_slot` and remembers the
+ * first empty or deleted slot on the way. With Robin Hood probing, the
+ * entries from the insertion point up to the next empty slot are shifted one
+ * slot forward, so the returned slot is empty.
+ *
+ * @param table A pointer to the hash table.
+ * @param key A pointer to the key to insert.
+ * @param hash The hash code of the key, see `get_full_hash_code`.
+ * @param index Receives the index of the free slot, of the slot holding the
+ * key if it is already present, or `table->capacity` if there is no free
+ * slot left.
+ * @param control Receives the control byte to store in the free slot.
+ * @return True if a free slot is found, false if the key is already present
+ * or there is no free slot left.
+ */
+bool_t prepare_insert_slot(hash_table_t *table, const void *key, size_t hash,
+                           size_t *index, uint8_t *control);
+
+/**
+ * @brief Gives back a slot returned by `prepare_insert_slot` that could not
+ * be filled, such as when allocating the node of the entry fails.
+ *
+ * @details With group probing the slot was left as it was, so nothing is
+ * done. With Robin Hood probing, the entries shifted forward to free the
+ * slot are shifted back, so none of them becomes unreachable.
+ */
+void cancel_insert_slot(hash_table_t *table, size_t index);
+
+/**
+ * @brief Marks an occupied slot as free after its entry was destructed.
+ *
+ * @details With group probing, the slot becomes empty when its group already
+ * has an empty slot (no probe sequence goes past such a group), and deleted
+ * otherwise. With Robin Hood probing, the following entries are shifted one
+ * slot back, so no deleted slot is left.
+ */
+void release_slot(hash_table_t *table, size_t index);
+
+/**
+ * @brief Claims the first empty slot of the probe sequence of a hash code,
+ * safely against other threads claiming slots of the same table.
+ *
+ * @details Only for group probing, on slots being filled with distinct keys
+ * and without removals, such as the new slots of a resize: no key is
+ * compared and the only synchronization is an atomic exchange of the control
+ * byte, which receives the fingerprint of the hash. The caller then owns the
+ * slot and stores the entry. Needs compiler atomics (GCC or Clang).
+ *
+ * @param table A pointer to the hash table.
+ * @param hash The hash code of the key to place.
+ * @return The index of the claimed slot, or `table->capacity` if there is no
+ * empty slot left or atomics are unavailable.
+ */
+size_t claim_empty_slot(hash_table_t *table, size_t hash);
+
+/**
+ * @brief Returns the probe length of the entry in an occupied slot.
+ *
+ * @details That is the number of groups (group probing) or slots (Robin Hood
+ * probing) a lookup of its key visits, computed from the stored hash code.
+ */
+size_t get_slot_probe_length(const hash_table_t *table, size_t index);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef PROBING_H
+#define PROBING_H
+
+#include "../types/hash_table.h"
+
+/**
+ * @brief Returns the fingerprint of a key stored in the control byte of its
+ * slot, taken from the high bits of the key hash (the low bits select the
+ * probe position).
+ */
+static inline uint8_t get_fingerprint(size_t hash) {
+  return (uint8_t)(hash >> (sizeof(size_t) * 8 - 7)) & SLOT_FINGERPRINT_MASK;
+}
+
+bool_t group_find_key_slot(const hash_table_t *table, const void *key,
+                           size_t hash, size_t *index);
+bool_t group_prepare_insert_slot(hash_table_t *table, const void *key,
+                                 size_t hash, size_t *index, uint8_t *control);
+void group_release_slot(hash_table_t *table, size_t index);
+size_t group_claim_empty_slot(hash_table_t *table, size_t hash);
+
+bool_t robin_hood_find_key_slot(const hash_table_t *table, const void *key,
+                                size_t hash, size_t *index);
+bool_t robin_hood_prepare_insert_slot(hash_table_t *table, const void *key,
+                                      size_t hash, size_t *index,
+                                      uint8_t *control);
+void robin_hood_cancel_insert_slot(hash_table_t *table, size_t index);
+void robin_hood_release_slot(hash_table_t *table, size_t index);
+
+#endif
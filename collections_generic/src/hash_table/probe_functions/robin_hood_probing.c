@@ -0,0 +1,102 @@
+#include "../slot_functions/slot_functions.h"
+#include "probing.h"
+
+static size_t get_next_slot(const hash_table_t *table, size_t index) {
+  return (index + 1) & (table->capacity - 1);
+}
+
+static size_t get_previous_slot(const hash_table_t *table, size_t index) {
+  return (index - 1) & (table->capacity - 1);
+}
+
+bool_t robin_hood_find_key_slot(const hash_table_t *table, const void *key,
+                                size_t hash, size_t *index) {
+  size_t slot = hash & (table->capacity - 1);
+  uint8_t fingerprint = get_fingerprint(hash);
+
+  for (uint32_t distance = 0; distance < table->capacity; distance++) {
+    uint8_t control = table->controls[slot];
+    if (control == SLOT_EMPTY || table->distances[slot] < distance)
+      return false;
+
+    if (control == fingerprint && table->hashes[slot] == hash &&
+        table->key_manager.compare(get_slot_key(table, slot), key) == 0) {
+      *index = slot;
+      return true;
+    }
+    slot = get_next_slot(table, slot);
+  }
+  return false;
+}
+
+bool_t robin_hood_prepare_insert_slot(hash_table_t *table, const void *key,
+                                      size_t hash, size_t *index,
+                                      uint8_t *control) {
+  size_t slot = hash & (table->capacity - 1);
+  uint8_t fingerprint = get_fingerprint(hash);
+
+  // skip entries at least as far from their home slot as the key would be
+  uint32_t distance = 0;
+  for (; distance < table->capacity; distance++) {
+    uint8_t slot_control = table->controls[slot];
+    if (slot_control == SLOT_EMPTY || table->distances[slot] < distance)
+      break;
+
+    if (slot_control == fingerprint && table->hashes[slot] == hash &&
+        table->key_manager.compare(get_slot_key(table, slot), key) == 0) {
+      *index = slot;
+      return false;
+    }
+    slot = get_next_slot(table, slot);
+  }
+
+  size_t empty = slot;
+  while (table->controls[empty] != SLOT_EMPTY) {
+    empty = get_next_slot(table, empty);
+    if (empty == slot) {
+      *index = table->capacity;
+      return false;
+    }
+  }
+
+  // shift the run between the insertion point and the empty slot forward
+  while (empty != slot) {
+    size_t previous = get_previous_slot(table, empty);
+    move_slot(table, previous, empty);
+    table->distances[empty] = table->distances[previous] + 1;
+    empty = previous;
+  }
+
+  table->controls[slot] = SLOT_EMPTY;
+  table->distances[slot] = distance;
+  *index = slot;
+  *control = fingerprint;
+  return true;
+}
+
+/**
+ * @brief Shifts the entries following a free slot that are not in their
+ * home slot one slot back, and empties the last slot of the run.
+ */
+static void shift_back_run(hash_table_t *table, size_t index) {
+  size_t next = get_next_slot(table, index);
+  while (IS_SLOT_OCCUPIED(table->controls[next]) &&
+         table->distances[next] > 0) {
+    move_slot(table, next, index);
+    table->distances[index] = table->distances[next] - 1;
+    index = next;
+    next = get_next_slot(table, next);
+  }
+
+  table->controls[index] = SLOT_EMPTY;
+}
+
+void robin_hood_cancel_insert_slot(hash_table_t *table, size_t index) {
+  // the run shifted forward by robin_hood_prepare_insert_slot moves back
+  shift_back_run(table, index);
+}
+
+void robin_hood_release_slot(hash_table_t *table, size_t index) {
+  shift_back_run(table, index);
+  table->count_with_deleted--;
+}
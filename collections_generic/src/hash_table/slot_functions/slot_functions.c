@@ -0,0 +1,120 @@
+#include "slot_functions.h"
+#include "../../support/validators.h"
+#include "../node_functions/node_functions.h"
+#include "../type_manager_functions/type_manager_functions.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+bool_t allocate_slots(hash_table_t *table, size_t capacity) {
+  uint8_t *controls = calloc(capacity, sizeof(uint8_t));
+  size_t *hashes = NULL;
+  uint32_t *distances = NULL;
+  hash_table_node_t **nodes = NULL;
+  char *keys = NULL;
+  char *values = NULL;
+
+  bool_t failure = MALLOC_FAILURE_CHECK(controls);
+  if (!failure) {
+    hashes = calloc(capacity, sizeof(size_t));
+    failure = MALLOC_FAILURE_CHECK(hashes);
+  }
+  if (!failure && table->probing == ROBIN_HOOD_PROBING) {
+    distances = calloc(capacity, sizeof(uint32_t));
+    failure = MALLOC_FAILURE_CHECK(distances);
+  }
+  if (!failure && table->storage == FLAT_STORAGE) {
+    // +1 keeps the allocations non-empty for zero-sized keys or values, and
+    // zeroing them keeps the never used slots of a snapshot deterministic
+    keys = calloc(capacity * table->key_manager.size_of_obj + 1, 1);
+    values = calloc(capacity * table->value_manager.size_of_obj + 1, 1);
+    failure = MALLOC_FAILURE_CHECK(keys) || MALLOC_FAILURE_CHECK(values);
+  } else if (!failure) {
+    nodes = calloc(capacity, sizeof(hash_table_node_t *));
+    failure = MALLOC_FAILURE_CHECK(nodes);
+  }
+
+  if (failure) {
+    free(controls);
+    free(hashes);
+    free(distances);
+    free(nodes);
+    free(keys);
+    free(values);
+    return false;
+  }
+  memset(controls, SLOT_EMPTY, capacity * sizeof(uint8_t));
+
+  table->controls = controls;
+  table->hashes = hashes;
+  table->distances = distances;
+  table->nodes = nodes;
+  table->keys = keys;
+  table->values = values;
+  return true;
+}
+
+void free_slots(hash_table_t *table) {
+  free(table->controls);
+  free(table->hashes);
+  free(table->distances);
+  free(table->nodes);
+  free(table->keys);
+  free(table->values);
+  table->controls = NULL;
+  table->hashes = NULL;
+  table->distances = NULL;
+  table->nodes = NULL;
+  table->keys = NULL;
+  table->values = NULL;
+}
+
+bool_t store_in_slot(hash_table_t *table, size_t index, uint8_t control,
+                     size_t hash, const void *key, const void *value) {
+  if (table->storage == FLAT_STORAGE) {
+    use_user_copy_or_memcpy(&table->key_manager, key, get_slot_key(table, index));
+    if (value != NULL) {
+      use_user_copy_or_memcpy(&table->value_manager, value,
+                              get_slot_value(table, index));
+    } else {
+      memset(get_slot_value(table, index), 0,
+             table->value_manager.size_of_obj);
+    }
+  } else {
+    table->nodes[index] = create_hash_table_node(
+        &table->key_manager, &table->value_manager, key, value);
+    if (table->nodes[index] == NULL) {
+      return false;
+    }
+  }
+  table->hashes[index] = hash;
+  table->controls[index] = control;
+  return true;
+}
+
+void destruct_slot(hash_table_t *table, size_t index) {
+  if (table->storage == FLAT_STORAGE)
+    return;
+
+  destruct_hash_table_node(&table->key_manager, &table->value_manager,
+                           table->nodes[index]);
+  table->nodes[index] = NULL;
+}
+
+void transfer_slot(hash_table_t *source, size_t from, hash_table_t *target,
+                   size_t to) {
+  if (target->storage == FLAT_STORAGE) {
+    memcpy(get_slot_key(target, to), get_slot_key(source, from),
+           target->key_manager.size_of_obj);
+    memcpy(get_slot_value(target, to), get_slot_value(source, from),
+           target->value_manager.size_of_obj);
+  } else {
+    target->nodes[to] = source->nodes[from];
+  }
+  target->hashes[to] = source->hashes[from];
+  target->controls[to] = source->controls[from];
+}
+
+void move_slot(hash_table_t *table, size_t from, size_t to) {
+  transfer_slot(table, from, table, to);
+}
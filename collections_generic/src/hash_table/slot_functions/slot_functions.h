@@ -0,0 +1,85 @@
+#ifndef SLOT_FUNCTIONS_H
+#define SLOT_FUNCTIONS_H
+
+#include "../types/hash_table.h"
+
+/**
+ * @brief Returns a pointer to the key stored in the given occupied slot.
+ */
+static inline void *get_slot_key(const hash_table_t *table, size_t index) {
+  if (table->storage == FLAT_STORAGE)
+    return table->keys + index * table->key_manager.size_of_obj;
+  return table->nodes[index]->key;
+}
+
+/**
+ * @brief Returns a pointer to the value stored in the given occupied slot.
+ *
+ * @note In node storage the pointer is NULL if the entry was added without a
+ * value.
+ */
+static inline void *get_slot_value(const hash_table_t *table, size_t index) {
+  if (table->storage == FLAT_STORAGE)
+    return table->values + index * table->value_manager.size_of_obj;
+  return table->nodes[index]->value;
+}
+
+/**
+ * @brief Allocates empty slot arrays of the given capacity for the table.
+ *
+ * @details Only the arrays used by `table->storage` and `table->probing` are
+ * allocated, the others are set to NULL. Every array is zeroed, so a
+ * snapshot never writes uninitialized bytes. `table->capacity` is not
+ * modified.
+ *
+ * @return True on success, false on allocation failure (the table is not
+ * modified in that case).
+ */
+bool_t allocate_slots(hash_table_t *table, size_t capacity);
+
+/**
+ * @brief Frees the slot arrays of the table without destructing entries.
+ */
+void free_slots(hash_table_t *table);
+
+/**
+ * @brief Copies the key and the value into a free slot and marks it occupied.
+ *
+ * @param control Control byte (key fingerprint) to store for the slot.
+ * @param hash Full hash code of the key, see `get_full_hash_code`.
+ * @param value Value to copy, may be NULL (the value is zeroed in flat
+ * storage).
+ * @return True on success, false on allocation failure.
+ */
+bool_t store_in_slot(hash_table_t *table, size_t index, uint8_t control,
+                     size_t hash, const void *key, const void *value);
+
+/**
+ * @brief Destructs the entry stored in an occupied slot.
+ *
+ * @details The control byte is left unchanged, the caller is responsible
+ * for releasing the slot.
+ */
+void destruct_slot(hash_table_t *table, size_t index);
+
+/**
+ * @brief Relocates the entry of an occupied slot into a free slot of the same
+ * table.
+ *
+ * @details The entry is moved as raw bytes (flat storage) or by pointer (node
+ * storage): no user `copy` or `destruct` is called. The control byte and
+ * the hash code are copied along; the source slot keeps its stale contents and control byte,
+ * the caller is responsible for releasing or overwriting it.
+ */
+void move_slot(hash_table_t *table, size_t from, size_t to);
+
+/**
+ * @brief Relocates the entry of an occupied slot into a free slot of another
+ * set of slot arrays with the same storage and type managers.
+ *
+ * @details Works like `move_slot` across two tables.
+ */
+void transfer_slot(hash_table_t *source, size_t from, hash_table_t *target,
+                   size_t to);
+
+#endif
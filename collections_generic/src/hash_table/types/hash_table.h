@@ -1,37 +1,200 @@
 #ifndef HASH_TABLE_T_H
 #define HASH_TABLE_T_H
 
+#include <stdint.h>
+
 #include "hash_table_node.h"
+#include "hash_table_stats.h"
 #include "type_manager.h"
 
-#define DEFAULT_HASH_TABLE_SIZE 100
+/**
+ * @brief Number of slots whose control bytes are matched at once while
+ * probing. Capacities are always multiples of it.
+ */
+#define HASH_TABLE_GROUP_SIZE 16
+
+/**
+ * @brief Initial capacity of a hash table.
+ *
+ * @details Capacities are always powers of two, so probe positions are
+ * reduced with a mask instead of a division. `RESIZE_FACTOR` keeps them so.
+ */
+#define DEFAULT_HASH_TABLE_SIZE (8 * HASH_TABLE_GROUP_SIZE)
 #define REHASH_THRESHOLD 0.75f
 
+/**
+ * @brief Load below which a table with `hash_table_t::auto_shrink` set is
+ * shrunk after a removal. Far below `REHASH_THRESHOLD`, so that a shrunk
+ * table does not grow back right away.
+ */
+#define HASH_TABLE_SHRINK_THRESHOLD 0.125f
+
+/**
+ * @brief False positive rate of the Bloom filter of a table with
+ * `hash_table_t::filter` set, about 10 bits per entry.
+ */
+#define HASH_TABLE_FILTER_FALSE_POSITIVE_RATE 0.01
+
 #define RESIZE_FACTOR 2
 
+/**
+ * @brief Number of old slots migrated by each insertion or removal while an
+ * incremental resize is in progress.
+ */
+#define HASH_TABLE_MIGRATION_STEP HASH_TABLE_GROUP_SIZE
+
+/**
+ * @brief Smallest number of old slots for which a resize is split between
+ * `hash_table_t::resize_threads` threads. Below it, starting the threads
+ * costs more than they save.
+ */
+#define HASH_TABLE_PARALLEL_RESIZE_MIN (1 << 15)
+
+/**
+ * @brief Probe length, in slots, above which an insertion is a sign of keys
+ * crafted to collide.
+ *
+ * @details The next insertion then draws a new `hash_seed` and rebuilds the
+ * table with it. This only helps a user `get_hash_code` that honours its
+ * `key_gen` argument: a user hash ignoring it gives colliding keys equal
+ * hash codes whatever the seed. To bound the cost for such keys, a table is
+ * reseeded at most once per doubling of its count.
+ */
+#define HASH_TABLE_LONG_PROBE (8 * HASH_TABLE_GROUP_SIZE)
+
+/**
+ * @brief Number of keys hashed and prefetched ahead of their probes by
+ * `get_many_from_hash_table`.
+ */
+#define HASH_TABLE_LOOKUP_BATCH 32
+
+/**
+ * @brief Control bytes, stored one byte per slot in `hash_table_t::controls`.
+ *
+ * @details An occupied slot stores a 7-bit fingerprint of the key hash (the
+ * high bit is clear), so most non-matching slots are rejected without calling
+ * `key_manager.compare`. Empty and deleted slots have the high bit set.
+ */
+#define SLOT_EMPTY 0x80   /**< The slot has never been used. */
+#define SLOT_DELETED 0xFE /**< The slot held an entry that was removed. */
+#define SLOT_FINGERPRINT_MASK 0x7F
+#define IS_SLOT_OCCUPIED(control) (((control) & 0x80) == 0)
+
+/**
+ * @brief The way entries are laid out in a hash table.
+ *
+ * @details With `NODE_STORAGE` every slot points to a separately allocated
+ * node holding separately allocated key and value. With `FLAT_STORAGE` keys
+ * and values are stored inline in two contiguous arrays, `size_of_obj` bytes
+ * per slot, so a lookup touches one key slot instead of three allocations.
+ * Flat storage is used when neither keys nor values have a user `destruct`,
+ * because a user `destruct` is expected to free the object itself.
+ */
+typedef enum hash_table_storage_t {
+  NODE_STORAGE = 0, /**< Slots are pointers to nodes. */
+  FLAT_STORAGE = 1  /**< Keys and values are stored inline. */
+} hash_table_storage_t;
+
+/**
+ * @brief The way slots are probed in a hash table.
+ *
+ * @details `GROUP_PROBING` matches fingerprints group by group and leaves
+ * deleted slots behind on removal. `ROBIN_HOOD_PROBING` probes slot by slot,
+ * keeps entries ordered by their distance from their home slot and shifts
+ * following entries back on removal, so there are never deleted slots and the
+ * table never needs `re_hash_hash_table`.
+ */
+typedef enum hash_table_probing_t {
+  GROUP_PROBING = 0,     /**< Group probing with deleted slots. */
+  ROBIN_HOOD_PROBING = 1 /**< Robin Hood probing with backward-shift removal. */
+} hash_table_probing_t;
+
 /**
  * @brief A hash table.
  *
  * @details This struct represents a hash table.
  *
  * @param capacity Maximum number of elements in the table.
- * @param count Number of elements in the table (excluding deleted nodes).
+ * @param count Number of elements in the table (excluding deleted nodes),
+ * including those still in migration_source.
  * @param count_with_deleted Number of elements in the table (including deleted nodes).
- * @param nodes Array of pointers to nodes.
+ * @param storage The way entries are laid out.
+ * @param probing The way slots are probed.
+ * @param controls Array of slot control bytes.
+ * @param hashes Array of the full hash codes of the stored keys.
+ * @param distances Array of distances from the home slot (Robin Hood probing
+ * only).
+ * @param nodes Array of pointers to nodes (node storage only).
+ * @param keys Array of inline keys (flat storage only).
+ * @param values Array of inline values (flat storage only).
  * @param key_manager A type manager for the keys in the hash table.
  * @param value_manager A type manager for the values in the hash table.
  * @param get_hash_code Function pointer to get hash codes.
+ * @param hash_seed Seed of the key hashes, 0 for unseeded hashes.
+ * @param long_probe_seen Whether an insertion ended far from its home slot.
+ * @param count_at_reseed Number of entries at the last reseed.
+ * @param incremental_resize Whether resizes are spread over later operations.
+ * @param auto_shrink Whether removals shrink a mostly empty table.
+ * @param resize_threads Number of threads moving entries during a resize.
+ * @param migration_source Old slots still being migrated, or NULL.
+ * @param migrated_slots Number of slots of migration_source already migrated.
+ * @param mapping The file mapping the slot arrays live in, or NULL.
+ * @param mapping_size Size of the mapping in bytes.
+ * @param counters Resize and rehash counters (`HASH_TABLE_STATS` only).
  */
 typedef struct hash_table_t {
   size_t capacity; /**< Maximum number of elements in the table. */
   size_t count; /**< Number of elements in the table (excluding deleted nodes). */
   size_t count_with_deleted; /**< Number of elements in the table (including deleted nodes). */
-  hash_table_node_t **nodes; /**< Array of pointers to nodes. */
+  hash_table_storage_t storage; /**< The way entries are laid out. */
+  hash_table_probing_t probing; /**< The way slots are probed. */
+  uint8_t *controls; /**< Array of slot control bytes (SLOT_EMPTY, SLOT_DELETED or a fingerprint). */
+  size_t *hashes; /**< Array of the full hash codes of the stored keys, so
+                     probes compare hashes before keys and resizes do not
+                     hash keys again. */
+  uint32_t *distances; /**< Array of distances from the home slot (Robin Hood probing only). */
+  hash_table_node_t **nodes; /**< Array of pointers to nodes (node storage only). */
+  char *keys; /**< Array of inline keys (flat storage only). */
+  char *values; /**< Array of inline values (flat storage only). */
   type_manager_t key_manager; /**< A type manager for the keys in the hash table. */
   type_manager_t value_manager; /**< A type manager for the values in the hash table. */
 
   get_hash_code_t get_hash_code; /**< Function pointer to get hash codes. */
+  size_t hash_seed; /**< Seed of the key hashes, random by default, so keys
+                       colliding in one table do not collide in another. 0
+                       gives the unseeded hash. */
+  bool_t long_probe_seen; /**< Whether an insertion ended at least
+                             HASH_TABLE_LONG_PROBE slots away from its home
+                             slot since the last rebuild. */
+  size_t count_at_reseed; /**< Number of entries when the table was last
+                             reseeded because of long probes. */
+
+  bool_t incremental_resize; /**< Whether resizes are spread over later
+                                operations instead of moving every entry at
+                                once. Off by default. */
+  bool_t auto_shrink; /**< Whether removals shrink the table once its count
+                         falls below HASH_TABLE_SHRINK_THRESHOLD of its
+                         capacity. Off by default. */
+  size_t resize_threads; /**< Number of threads moving entries during a
+                            full resize or rehash of a group-probed table of
+                            at least HASH_TABLE_PARALLEL_RESIZE_MIN slots. 0
+                            or 1 moves them on the calling thread only. */
+  struct hash_table_t *migration_source; /**< Old slots still being migrated
+                                            during an incremental resize, or
+                                            NULL. */
+  size_t migrated_slots; /**< Number of slots of migration_source already
+                            migrated. */
+  void *mapping; /**< The snapshot file mapping the slot arrays live in, or
+                    NULL. A mapped table is read-only. */
+  size_t mapping_size; /**< Size of the mapping in bytes. */
+  struct bloom_filter_t *filter; /**< Bloom filter of the stored hashes,
+                                    consulted before probing so lookups of
+                                    absent keys usually touch no slot, or
+                                    NULL. Off by default. */
+#ifdef HASH_TABLE_STATS
+  hash_table_counters_t counters; /**< Resize and rehash counters. */
+#endif
 } hash_table_t;
 
 
-#endif
\ No newline at end of file
+#endif
@@ -5,14 +5,13 @@
 /**
  * @brief A node in a hash table.
  *
- * @details This struct represents a node in a hash table. It contains a key,
- * a value, and a flag indicating whether the node has been marked as deleted.
+ * @details This struct represents a node in a hash table with node storage.
+ * It contains a key and a value. Whether the slot holding the node is deleted
+ * is kept in `hash_table_t::controls`.
  */
 typedef struct hash_table_node_t {
   void *key;      /**< Pointer to the key stored in the node. */
   void *value;    /**< Pointer to the value stored in the node. */
-  bool_t is_deleted; /**< Flag indicating whether the node has been marked as
-                     deleted. */
 } hash_table_node_t;
 
-#endif
\ No newline at end of file
+#endif
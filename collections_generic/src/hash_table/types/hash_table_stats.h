@@ -0,0 +1,64 @@
+#ifndef HASH_TABLE_STATS_T_H
+#define HASH_TABLE_STATS_T_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of buckets of the probe length histogram. The last bucket
+ * counts every probe length of at least HASH_TABLE_STATS_HISTOGRAM_SIZE.
+ */
+#define HASH_TABLE_STATS_HISTOGRAM_SIZE 16
+
+/**
+ * @brief Resize and rehash counters kept by a hash table.
+ *
+ * @details The counters are only compiled in when `HASH_TABLE_STATS` is
+ * defined (`make STATS=1`), so tables built without it pay nothing for them.
+ *
+ * @param resize_count Number of resizes, including incremental ones.
+ * @param rehash_count Number of rebuilds at the same or a smaller capacity.
+ * @param resize_nanoseconds Time spent moving entries during resizes.
+ * @param rehash_nanoseconds Time spent moving entries during rehashes.
+ */
+typedef struct hash_table_counters_t {
+  uint64_t resize_count; /**< Number of resizes, including incremental ones. */
+  uint64_t rehash_count; /**< Number of rebuilds at the same or a smaller
+                            capacity. */
+  uint64_t resize_nanoseconds; /**< Time spent moving entries during resizes. */
+  uint64_t rehash_nanoseconds; /**< Time spent moving entries during rehashes. */
+} hash_table_counters_t;
+
+/**
+ * @brief A summary of the state of a hash table, filled by
+ * `hash_table_stats`.
+ *
+ * @details The probe length of an entry is the number of groups (group
+ * probing) or slots (Robin Hood probing) a lookup of its key visits. A good
+ * hash function keeps almost every entry in the first bucket; a long tail
+ * points at a `get_hash_code` that maps many keys to the same positions.
+ *
+ * @param capacity Number of slots.
+ * @param count Number of entries.
+ * @param tombstones Number of deleted slots still occupying the table.
+ * @param load_factor Ratio of entries and deleted slots to slots.
+ * @param probe_length_histogram Entry counts by probe length, bucket `i`
+ * holding probe length `i + 1`.
+ * @param max_probe_length Longest probe length of an entry.
+ * @param mean_probe_length Average probe length of the entries.
+ * @param counters Resize and rehash counters, zero unless `HASH_TABLE_STATS`
+ * is defined.
+ */
+typedef struct hash_table_stats_t {
+  size_t capacity; /**< Number of slots. */
+  size_t count; /**< Number of entries. */
+  size_t tombstones; /**< Number of deleted slots still occupying the table. */
+  double load_factor; /**< Ratio of entries and deleted slots to slots. */
+  size_t probe_length_histogram[HASH_TABLE_STATS_HISTOGRAM_SIZE]; /**< Entry
+      counts by probe length, bucket `i` holding probe length `i + 1`. */
+  size_t max_probe_length; /**< Longest probe length of an entry. */
+  double mean_probe_length; /**< Average probe length of the entries. */
+  hash_table_counters_t counters; /**< Resize and rehash counters. */
+} hash_table_stats_t;
+
+#endif
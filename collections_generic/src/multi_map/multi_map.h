@@ -0,0 +1,8 @@
+#ifndef MULTI_MAP_H
+#define MULTI_MAP_H
+#include "../hash_table/hash_table.h"
+
+#include "multi_map_functions/base/base_functions.h"
+#include "types/multi_map_t.h"
+
+#endif
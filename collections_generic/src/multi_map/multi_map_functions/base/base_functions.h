@@ -0,0 +1,76 @@
+#ifndef BASE_FUNCTIONS_MULTI_MAP_H
+#define BASE_FUNCTIONS_MULTI_MAP_H
+
+#include "../../types/multi_map_t.h"
+
+/**
+ * Creates a new multi-map.
+ *
+ * @param key_size size of the keys
+ * @param key_copy function for copying the keys
+ * @param key_destruct function for destroying the keys
+ * @param key_compare function for comparing the keys
+ * @param value_size size of the values
+ * @param value_copy function for copying the values
+ * @param value_destruct function for releasing what a value owns, or NULL
+ * @param value_compare function for comparing the values
+ *
+ * @return a pointer to the newly created multi-map, or NULL on failure
+ *
+ * @note Values are stored inline in their runs, so `value_destruct` is called
+ * on each value in place when its key is removed or the multi-map is
+ * destructed: it must free the memory the value owns, not the value itself.
+ */
+multi_map_t *create_multi_map(size_t key_size, copy_t key_copy,
+                              destruct_t key_destruct, compare_t key_compare,
+                              size_t value_size, copy_t value_copy,
+                              destruct_t value_destruct,
+                              compare_t value_compare);
+
+/**
+ * Deallocates all memory used by the given multi-map, including the
+ * multi-map itself.
+ *
+ * @param map Pointer to the multi-map to be deallocated.
+ */
+void destruct_multi_map(multi_map_t *map);
+
+/**
+ * @brief Appends a value to the values of a key, adding the key if it is
+ * missing.
+ *
+ * @details The key is probed once. The value is copied at the end of the
+ * run of the key, which grows when it is full.
+ *
+ * @return True on success, false on failure.
+ */
+bool_t add_to_multi_map(multi_map_t *map, const void *key, const void *value);
+
+/**
+ * @brief Returns the values of a key without copying them.
+ *
+ * @details The values are contiguous, `value_size` bytes each, in the order
+ * they were added. They are borrowed from the multi-map and stay valid until
+ * the next insertion or removal.
+ *
+ * @param map A pointer to the multi-map.
+ * @param key A pointer to the key.
+ * @param count Receives the number of values, 0 if the key is missing.
+ * @return A pointer to the first value, or NULL if the key is missing.
+ */
+const void *get_values_from_multi_map(const multi_map_t *map, const void *key,
+                                      size_t *count);
+
+/**
+ * @brief Checks if a key has values in a multi-map.
+ */
+bool_t contains_key_in_multi_map(const multi_map_t *map, const void *key);
+
+/**
+ * @brief Removes a key and all of its values.
+ *
+ * @return True if the key was found and removed, false otherwise.
+ */
+bool_t remove_from_multi_map(multi_map_t *map, const void *key);
+
+#endif
@@ -0,0 +1,81 @@
+#include "../../../hash_table/hash_table.h"
+#include "../../../hash_table/type_manager_functions/type_manager_functions.h"
+#include "../../../support/validators.h"
+#include "../common/value_runs.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+static bool_t grow_run(value_run_t *run, size_t value_size) {
+  size_t capacity = run->capacity == 0 ? DEFAULT_VALUE_RUN_SIZE
+                                       : run->capacity * RESIZE_FACTOR;
+  // +1 keeps the allocation non-empty for zero-sized values
+  char *values = realloc(run->values, capacity * value_size + 1);
+  if (MALLOC_FAILURE_CHECK(values)) {
+    return false;
+  }
+  run->values = values;
+  run->capacity = capacity;
+  return true;
+}
+
+bool_t add_to_multi_map(multi_map_t *map, const void *key, const void *value) {
+  if (NULL_ARGUMENT_CHECK(map) || NULL_ARGUMENT_CHECK(key) ||
+      NULL_ARGUMENT_CHECK(value)) {
+    return false;
+  }
+
+  value_run_t empty = {0, 0, NULL};
+  bool_t inserted;
+  value_run_t *run = upsert_in_hash_table(map->table, key, &empty, &inserted);
+  if (run == NULL) {
+    return false;
+  }
+  size_t value_size = map->value_manager.size_of_obj;
+  if (run->count == run->capacity && !grow_run(run, value_size)) {
+    // a key without values would still be counted and found
+    if (inserted)
+      remove_from_hash_table(map->table, key);
+    return false;
+  }
+  use_user_copy_or_memcpy(&map->value_manager, value,
+                          run->values + run->count * value_size);
+  run->count++;
+  return true;
+}
+
+const void *get_values_from_multi_map(const multi_map_t *map, const void *key,
+                                      size_t *count) {
+  if (NULL_ARGUMENT_CHECK(map) || NULL_ARGUMENT_CHECK(key) ||
+      NULL_ARGUMENT_CHECK(count)) {
+    return NULL;
+  }
+
+  const value_run_t *run = get_pointer_from_hash_table(map->table, key);
+  if (run == NULL) {
+    *count = 0;
+    return NULL;
+  }
+  *count = run->count;
+  return run->values;
+}
+
+bool_t contains_key_in_multi_map(const multi_map_t *map, const void *key) {
+  if (NULL_ARGUMENT_CHECK(map) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  return contains_key(map->table, key);
+}
+
+bool_t remove_from_multi_map(multi_map_t *map, const void *key) {
+  if (NULL_ARGUMENT_CHECK(map) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  const value_run_t *run = get_pointer_from_hash_table(map->table, key);
+  if (run == NULL) {
+    return false;
+  }
+  free_value_run(&map->value_manager, run);
+  return remove_from_hash_table(map->table, key);
+}
@@ -0,0 +1,26 @@
+#include "../../../hash_table/hash_table.h"
+#include "../../../support/validators.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+multi_map_t *create_multi_map(size_t key_size, copy_t key_copy,
+                              destruct_t key_destruct, compare_t key_compare,
+                              size_t value_size, copy_t value_copy,
+                              destruct_t value_destruct,
+                              compare_t value_compare) {
+  multi_map_t *map = calloc(1, sizeof(multi_map_t));
+  if (MALLOC_FAILURE_CHECK(map)) {
+    return NULL;
+  }
+
+  map->table = create_hash_table(key_size, key_copy, key_destruct, key_compare,
+                                 sizeof(value_run_t), NULL, NULL, NULL);
+  if (map->table == NULL) {
+    free(map);
+    return NULL;
+  }
+  type_manager_t tmp = {value_size, .copy = value_copy,
+                        .destruct = value_destruct, .compare = value_compare};
+  map->value_manager = tmp;
+  return map;
+}
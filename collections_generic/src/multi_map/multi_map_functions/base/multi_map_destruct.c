@@ -0,0 +1,24 @@
+#include "../../../hash_table/hash_table.h"
+#include "../../../hash_table/slot_functions/slot_functions.h"
+#include "../common/value_runs.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+static void free_runs(const type_manager_t *value_manager,
+                      hash_table_t *table) {
+  for (size_t i = 0; i < table->capacity; i++) {
+    if (IS_SLOT_OCCUPIED(table->controls[i]))
+      free_value_run(value_manager, get_slot_value(table, i));
+  }
+}
+
+void destruct_multi_map(multi_map_t *map) {
+  if (map == NULL)
+    return;
+
+  free_runs(&map->value_manager, map->table);
+  if (map->table->migration_source != NULL)
+    free_runs(&map->value_manager, map->table->migration_source);
+  destruct_hash_table(map->table);
+  free(map);
+}
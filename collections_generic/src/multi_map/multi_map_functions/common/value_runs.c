@@ -0,0 +1,11 @@
+#include "value_runs.h"
+#include <stdlib.h>
+
+void free_value_run(const type_manager_t *value_manager,
+                    const value_run_t *run) {
+  if (value_manager->destruct != NULL) {
+    for (size_t i = 0; i < run->count; i++)
+      value_manager->destruct(run->values + i * value_manager->size_of_obj);
+  }
+  free(run->values);
+}
@@ -0,0 +1,15 @@
+#ifndef VALUE_RUNS_H
+#define VALUE_RUNS_H
+
+#include "../../types/multi_map_t.h"
+
+/**
+ * @brief Releases the values of a run and its array.
+ *
+ * @details The value `destruct` is called on every value in place, so it must
+ * release what the value owns but not the value itself.
+ */
+void free_value_run(const type_manager_t *value_manager,
+                    const value_run_t *run);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef MULTI_MAP_T_H
+#define MULTI_MAP_T_H
+
+#include "../../hash_table/types/hash_table.h"
+
+#define DEFAULT_VALUE_RUN_SIZE 4
+
+/**
+ * @brief The values associated with one key of a multi-map.
+ *
+ * @details Values are stored inline and contiguously, in insertion order. The
+ * run grows by `RESIZE_FACTOR` when it is full.
+ *
+ * @param count Number of values in the run.
+ * @param capacity Number of values the run holds before growing.
+ * @param values Array of inline values.
+ */
+typedef struct value_run_t {
+  size_t count; /**< Number of values in the run. */
+  size_t capacity; /**< Number of values the run holds before growing. */
+  char *values; /**< Array of inline values. */
+} value_run_t;
+
+/**
+ * @brief A hash table associating each key with any number of values.
+ *
+ * @details Every key maps to a `value_run_t` stored in `table`, so appending
+ * a value allocates only when its run grows, and the values of a key are
+ * read in place.
+ *
+ * @param table The hash table mapping keys to value runs.
+ * @param value_manager A type manager for the values.
+ */
+typedef struct multi_map_t {
+  hash_table_t *table; /**< The hash table mapping keys to value runs. */
+  type_manager_t value_manager; /**< A type manager for the values. */
+} multi_map_t;
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef ORDERED_HASH_TABLE_H
+#define ORDERED_HASH_TABLE_H
+#include "../hash_table/hash_table.h"
+
+#include "ordered_hash_table_functions/base/base_functions.h"
+#include "types/ordered_hash_table_t.h"
+
+#endif
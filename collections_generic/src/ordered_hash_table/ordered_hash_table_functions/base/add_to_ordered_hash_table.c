@@ -0,0 +1,66 @@
+#include "../../../hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../../hash_table/node_functions/node_functions.h"
+#include "../../../hash_table/type_manager_functions/type_manager_functions.h"
+#include "../../../support/validators.h"
+#include "../common/ordered_entries.h"
+#include "base_functions.h"
+
+#include <string.h>
+
+static bool_t store_entry(ordered_hash_table_t *table, size_t entry,
+                          const void *key, const void *data) {
+  if (table->storage == NODE_STORAGE) {
+    table->nodes[entry] = create_hash_table_node(
+        &table->key_manager, &table->value_manager, key, data);
+    return table->nodes[entry] != NULL;
+  }
+
+  use_user_copy_or_memcpy(&table->key_manager, key,
+                          get_entry_key(table, entry));
+  if (data != NULL) {
+    use_user_copy_or_memcpy(&table->value_manager, data,
+                            get_entry_value(table, entry));
+  } else {
+    memset(get_entry_value(table, entry), 0, table->value_manager.size_of_obj);
+  }
+  return true;
+}
+
+bool_t add_to_ordered_hash_table(ordered_hash_table_t *table, const void *key,
+                                 const void *data) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash = get_key_hash_code(table->get_hash_code,
+                                  table->key_manager.size_of_obj, key);
+  size_t slot;
+  if (find_ordered_slot(table, key, hash, &slot)) {
+    return false;
+  }
+
+  if (table->entry_count == ORDERED_USABLE_ENTRIES(table->index_capacity)) {
+    // only grow when removed entries do not free up enough room
+    size_t index_capacity = table->index_capacity;
+    if (table->count >= table->entry_count / 2)
+      index_capacity *= 2;
+    if (!rebuild_ordered_entries(table, index_capacity)) {
+      return false;
+    }
+    find_ordered_slot(table, key, hash, &slot);
+  }
+
+  size_t entry = table->entry_count;
+  if (entry >= ORDERED_MAX_ENTRIES) {
+    return false;
+  }
+  if (!store_entry(table, entry, key, data)) {
+    return false;
+  }
+  table->hashes[entry] = hash;
+  table->removed[entry] = 0;
+  table->index[slot] = (uint32_t)entry;
+  table->entry_count++;
+  table->count++;
+  return true;
+}
@@ -0,0 +1,95 @@
+#ifndef BASE_FUNCTIONS_ORDERED_HASH_TABLE_H
+#define BASE_FUNCTIONS_ORDERED_HASH_TABLE_H
+
+#include "../../../hash_table/types/key_value_pair.h"
+#include "../../types/ordered_hash_table_t.h"
+
+/**
+ * Creates a new insertion-ordered hash table. The parameters are the same as
+ * for `create_hash_table`.
+ *
+ * @return a pointer to the newly created table, or NULL on failure
+ *
+ * @note If neither key_destruct nor value_destruct is set, entries are stored
+ * inline, otherwise every entry is a separately allocated node.
+ */
+ordered_hash_table_t *create_ordered_hash_table(
+    size_t key_size, copy_t key_copy, destruct_t key_destruct,
+    compare_t key_compare, size_t value_size, copy_t value_copy,
+    destruct_t value_destruct, compare_t value_compare);
+
+/**
+ * Deallocates all memory used by the given ordered hash table, including
+ * the table itself.
+ *
+ * @param table Pointer to the table to be deallocated.
+ */
+void destruct_ordered_hash_table(ordered_hash_table_t *table);
+
+/**
+ * @brief Appends a key-value pair after the existing entries.
+ *
+ * @details When the entry arrays are full, the entries are compacted and the
+ * index rebuilt, doubling its capacity if more than half of the entries are
+ * still live.
+ *
+ * @param table A pointer to the table.
+ * @param key A pointer to the key.
+ * @param data A pointer to the value, may be NULL.
+ * @return True if the pair was added, false if the key is already present or
+ * on failure.
+ */
+bool_t add_to_ordered_hash_table(ordered_hash_table_t *table, const void *key,
+                                 const void *data);
+
+/**
+ * @brief Copies the value associated with a key, like `get_from_hash_table`.
+ *
+ * @return True if the key was found and the value was copied, false
+ * otherwise.
+ */
+bool_t get_from_ordered_hash_table(const ordered_hash_table_t *table,
+                                   const void *key, void *data);
+
+/**
+ * @brief Checks if a key exists in an ordered hash table.
+ */
+bool_t contains_key_in_ordered_hash_table(const ordered_hash_table_t *table,
+                                          const void *key);
+
+/**
+ * @brief Replaces the value associated with a key, keeping the position of
+ * the entry.
+ *
+ * @return True if the key was found, false otherwise.
+ */
+bool_t change_in_ordered_hash_table(ordered_hash_table_t *table,
+                                    const void *key, const void *data);
+
+/**
+ * @brief Removes a key-value pair.
+ *
+ * @details The entry is destructed and marked removed, the entries after it
+ * keep their order and positions until the next resize.
+ *
+ * @return True if the key was found and removed, false otherwise.
+ */
+bool_t remove_from_ordered_hash_table(ordered_hash_table_t *table,
+                                      const void *key);
+
+/**
+ * @brief Iterates over the entries in insertion order.
+ *
+ * @details Start with `*position` set to 0 and call until it returns false.
+ * The pair receives pointers to the stored key and value, valid until the
+ * next insertion or removal.
+ *
+ * @param table A pointer to the table.
+ * @param position The iteration state, advanced past the returned entry.
+ * @param pair Receives the next entry.
+ * @return True if an entry was returned, false at the end of the table.
+ */
+bool_t next_in_ordered_hash_table(const ordered_hash_table_t *table,
+                                  size_t *position, key_value_pair_t *pair);
+
+#endif
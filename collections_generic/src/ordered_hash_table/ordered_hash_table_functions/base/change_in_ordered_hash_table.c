@@ -0,0 +1,22 @@
+#include "../../../hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../../hash_table/type_manager_functions/type_manager_functions.h"
+#include "../../../support/validators.h"
+#include "../common/ordered_entries.h"
+#include "base_functions.h"
+
+bool_t change_in_ordered_hash_table(ordered_hash_table_t *table,
+                                    const void *key, const void *data) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash = get_key_hash_code(table->get_hash_code,
+                                  table->key_manager.size_of_obj, key);
+  size_t slot;
+  if (!find_ordered_slot(table, key, hash, &slot)) {
+    return false;
+  }
+  use_user_copy_or_memcpy(&table->value_manager, data,
+                          get_entry_value(table, table->index[slot]));
+  return true;
+}
@@ -0,0 +1,16 @@
+#include "../../../hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../../support/validators.h"
+#include "../common/ordered_entries.h"
+#include "base_functions.h"
+
+bool_t contains_key_in_ordered_hash_table(const ordered_hash_table_t *table,
+                                          const void *key) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash = get_key_hash_code(table->get_hash_code,
+                                  table->key_manager.size_of_obj, key);
+  size_t slot;
+  return find_ordered_slot(table, key, hash, &slot);
+}
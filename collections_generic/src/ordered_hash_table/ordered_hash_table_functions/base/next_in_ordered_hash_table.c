@@ -0,0 +1,23 @@
+#include "../../../support/validators.h"
+#include "../common/ordered_entries.h"
+#include "base_functions.h"
+
+bool_t next_in_ordered_hash_table(const ordered_hash_table_t *table,
+                                  size_t *position, key_value_pair_t *pair) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(position) ||
+      NULL_ARGUMENT_CHECK(pair)) {
+    return false;
+  }
+
+  for (size_t entry = *position; entry < table->entry_count; entry++) {
+    if (table->removed[entry])
+      continue;
+
+    pair->key = get_entry_key(table, entry);
+    pair->value = get_entry_value(table, entry);
+    *position = entry + 1;
+    return true;
+  }
+  *position = table->entry_count;
+  return false;
+}
@@ -0,0 +1,40 @@
+#include "../../../support/validators.h"
+#include "../common/ordered_entries.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+ordered_hash_table_t *create_ordered_hash_table(
+    size_t key_size, copy_t key_copy, destruct_t key_destruct,
+    compare_t key_compare, size_t value_size, copy_t value_copy,
+    destruct_t value_destruct, compare_t value_compare) {
+
+  if (NULL_ARGUMENT_CHECK(key_compare)) {
+    return NULL;
+  }
+
+  ordered_hash_table_t *table = malloc(sizeof(ordered_hash_table_t));
+  if (MALLOC_FAILURE_CHECK(table)) {
+    return NULL;
+  }
+
+  type_manager_t tmp1 = {key_size, .copy = key_copy, .destruct = key_destruct,
+                         .compare = key_compare};
+  table->key_manager = tmp1;
+  type_manager_t tmp2 = {value_size, .copy = value_copy,
+                         .destruct = value_destruct, .compare = value_compare};
+  table->value_manager = tmp2;
+
+  table->storage = (key_destruct == NULL && value_destruct == NULL)
+                       ? FLAT_STORAGE
+                       : NODE_STORAGE;
+  if (!allocate_ordered_entries(table, DEFAULT_ORDERED_HASH_TABLE_SIZE)) {
+    free(table);
+    return NULL;
+  }
+
+  table->count = 0;
+  table->entry_count = 0;
+  table->get_hash_code = NULL;
+
+  return table;
+}
@@ -0,0 +1,23 @@
+#include "../../../hash_table/node_functions/node_functions.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+void destruct_ordered_hash_table(ordered_hash_table_t *table) {
+  if (table == NULL)
+    return;
+
+  if (table->storage == NODE_STORAGE) {
+    for (size_t entry = 0; entry < table->entry_count; entry++) {
+      if (!table->removed[entry])
+        destruct_hash_table_node(&table->key_manager, &table->value_manager,
+                                 table->nodes[entry]);
+    }
+  }
+  free(table->index);
+  free(table->hashes);
+  free(table->removed);
+  free(table->nodes);
+  free(table->keys);
+  free(table->values);
+  free(table);
+}
@@ -0,0 +1,30 @@
+#include "../../../hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../../hash_table/node_functions/node_functions.h"
+#include "../../../support/validators.h"
+#include "../common/ordered_entries.h"
+#include "base_functions.h"
+
+bool_t remove_from_ordered_hash_table(ordered_hash_table_t *table,
+                                      const void *key) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  size_t hash = get_key_hash_code(table->get_hash_code,
+                                  table->key_manager.size_of_obj, key);
+  size_t slot;
+  if (!find_ordered_slot(table, key, hash, &slot)) {
+    return false;
+  }
+
+  size_t entry = table->index[slot];
+  if (table->storage == NODE_STORAGE) {
+    destruct_hash_table_node(&table->key_manager, &table->value_manager,
+                             table->nodes[entry]);
+    table->nodes[entry] = NULL;
+  }
+  table->removed[entry] = 1;
+  table->index[slot] = ORDERED_INDEX_DELETED;
+  table->count--;
+  return true;
+}
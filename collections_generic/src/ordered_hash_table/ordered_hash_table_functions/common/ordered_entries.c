@@ -0,0 +1,150 @@
+#include "ordered_entries.h"
+#include "../../../support/error.h"
+#include "../../../support/validators.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+bool_t find_ordered_slot(const ordered_hash_table_t *table, const void *key,
+                         size_t hash, size_t *slot) {
+  size_t mask = table->index_capacity - 1;
+  bool_t found_deleted = false;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    uint32_t entry = table->index[i];
+    if (entry == ORDERED_INDEX_EMPTY) {
+      if (!found_deleted)
+        *slot = i;
+      return false;
+    }
+    if (entry == ORDERED_INDEX_DELETED) {
+      if (!found_deleted)
+        *slot = i;
+      found_deleted = true;
+    } else if (table->hashes[entry] == hash &&
+               table->key_manager.compare(get_entry_key(table, entry), key) ==
+                   0) {
+      *slot = i;
+      return true;
+    }
+  }
+}
+
+static uint32_t *allocate_index(size_t index_capacity) {
+  uint32_t *index = calloc(index_capacity, sizeof(uint32_t));
+  if (MALLOC_FAILURE_CHECK(index)) {
+    return NULL;
+  }
+  memset(index, 0xFF, index_capacity * sizeof(uint32_t));
+  return index;
+}
+
+static bool_t index_capacity_check(size_t index_capacity) {
+  if (ORDERED_USABLE_ENTRIES(index_capacity) > ORDERED_MAX_ENTRIES) {
+    ERROR_MESSAGE("The entry offsets would not fit in the index.");
+    return true;
+  }
+  return false;
+}
+
+static bool_t reallocate(void **array, size_t size) {
+  // +1 keeps the allocations non-empty for zero-sized keys or values
+  void *resized = realloc(*array, size + 1);
+  if (MALLOC_FAILURE_CHECK(resized)) {
+    return false;
+  }
+  *array = resized;
+  return true;
+}
+
+static bool_t reallocate_entries(ordered_hash_table_t *table,
+                                 size_t entry_capacity) {
+  bool_t success =
+      reallocate((void **)&table->hashes, entry_capacity * sizeof(size_t)) &&
+      reallocate((void **)&table->removed, entry_capacity * sizeof(uint8_t));
+  if (table->storage == FLAT_STORAGE) {
+    return success &&
+           reallocate((void **)&table->keys,
+                      entry_capacity * table->key_manager.size_of_obj) &&
+           reallocate((void **)&table->values,
+                      entry_capacity * table->value_manager.size_of_obj);
+  }
+  return success && reallocate((void **)&table->nodes,
+                               entry_capacity * sizeof(hash_table_node_t *));
+}
+
+bool_t allocate_ordered_entries(ordered_hash_table_t *table,
+                                size_t index_capacity) {
+  table->hashes = NULL;
+  table->removed = NULL;
+  table->nodes = NULL;
+  table->keys = NULL;
+  table->values = NULL;
+  if (index_capacity_check(index_capacity)) {
+    return false;
+  }
+  table->index = allocate_index(index_capacity);
+  if (table->index == NULL ||
+      !reallocate_entries(table, ORDERED_USABLE_ENTRIES(index_capacity))) {
+    free(table->index);
+    free(table->hashes);
+    free(table->removed);
+    free(table->nodes);
+    free(table->keys);
+    free(table->values);
+    return false;
+  }
+  table->index_capacity = index_capacity;
+  return true;
+}
+
+static void compact_entries(ordered_hash_table_t *table) {
+  size_t key_size = table->key_manager.size_of_obj;
+  size_t value_size = table->value_manager.size_of_obj;
+  size_t live = 0;
+  for (size_t entry = 0; entry < table->entry_count; entry++) {
+    if (table->removed[entry])
+      continue;
+
+    if (live != entry) {
+      table->hashes[live] = table->hashes[entry];
+      table->removed[live] = 0;
+      if (table->storage == FLAT_STORAGE) {
+        memmove(table->keys + live * key_size, table->keys + entry * key_size,
+                key_size);
+        memmove(table->values + live * value_size,
+                table->values + entry * value_size, value_size);
+      } else {
+        table->nodes[live] = table->nodes[entry];
+      }
+    }
+    live++;
+  }
+  table->entry_count = live;
+}
+
+bool_t rebuild_ordered_entries(ordered_hash_table_t *table,
+                               size_t index_capacity) {
+  if (index_capacity_check(index_capacity)) {
+    return false;
+  }
+  // allocate first, the old index stays valid until the entries move
+  uint32_t *index = allocate_index(index_capacity);
+  if (index == NULL ||
+      !reallocate_entries(table, ORDERED_USABLE_ENTRIES(index_capacity))) {
+    free(index);
+    return false;
+  }
+  compact_entries(table);
+
+  size_t mask = index_capacity - 1;
+  for (size_t entry = 0; entry < table->entry_count; entry++) {
+    size_t slot = table->hashes[entry] & mask;
+    while (index[slot] != ORDERED_INDEX_EMPTY)
+      slot = (slot + 1) & mask;
+    index[slot] = (uint32_t)entry;
+  }
+  free(table->index);
+  table->index = index;
+  table->index_capacity = index_capacity;
+  return true;
+}
@@ -0,0 +1,66 @@
+#ifndef ORDERED_ENTRIES_H
+#define ORDERED_ENTRIES_H
+
+#include "../../types/ordered_hash_table_t.h"
+
+/**
+ * @brief Returns a pointer to the key of the given entry.
+ */
+static inline void *get_entry_key(const ordered_hash_table_t *table,
+                                  size_t entry) {
+  if (table->storage == FLAT_STORAGE)
+    return table->keys + entry * table->key_manager.size_of_obj;
+  return table->nodes[entry]->key;
+}
+
+/**
+ * @brief Returns a pointer to the value of the given entry.
+ *
+ * @note In node storage the pointer is NULL if the entry was added without a
+ * value.
+ */
+static inline void *get_entry_value(const ordered_hash_table_t *table,
+                                    size_t entry) {
+  if (table->storage == FLAT_STORAGE)
+    return table->values + entry * table->value_manager.size_of_obj;
+  return table->nodes[entry]->value;
+}
+
+/**
+ * @brief Finds the index slot referring to the entry with the given key.
+ *
+ * @param hash The hash code of the key, see `get_key_hash_code`.
+ * @param slot Receives the index slot of the entry if the key is found, or
+ * the slot where it should be inserted otherwise (the first deleted slot of
+ * the probe sequence, or the empty slot ending it).
+ * @return True if the key is found, false otherwise.
+ */
+bool_t find_ordered_slot(const ordered_hash_table_t *table, const void *key,
+                         size_t hash, size_t *slot);
+
+/**
+ * @brief Allocates the index and entry arrays of an empty table.
+ *
+ * @return True on success, false on allocation failure or if the index
+ * capacity holds more than `ORDERED_MAX_ENTRIES` entries.
+ */
+bool_t allocate_ordered_entries(ordered_hash_table_t *table,
+                                size_t index_capacity);
+
+/**
+ * @brief Moves the live entries to the front of the entry arrays, keeping
+ * their order, and rebuilds an index of the given capacity from the stored
+ * hash codes.
+ *
+ * @details Keys are neither hashed nor compared, and no user `copy` or
+ * `destruct` is called. The index capacity must not be smaller than the
+ * current one, the entry arrays are never shrunk.
+ *
+ * @return True on success, false on allocation failure or if the index
+ * capacity holds more than `ORDERED_MAX_ENTRIES` entries (the entries keep
+ * their positions and the old index in that case).
+ */
+bool_t rebuild_ordered_entries(ordered_hash_table_t *table,
+                               size_t index_capacity);
+
+#endif
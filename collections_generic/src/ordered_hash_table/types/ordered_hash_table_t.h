@@ -0,0 +1,72 @@
+#ifndef ORDERED_HASH_TABLE_T_H
+#define ORDERED_HASH_TABLE_T_H
+
+#include <stdint.h>
+
+#include "../../hash_table/types/hash_table.h"
+
+#define DEFAULT_ORDERED_HASH_TABLE_SIZE 16
+
+/**
+ * @brief Values of `ordered_hash_table_t::index` slots that do not refer to
+ * an entry.
+ */
+#define ORDERED_INDEX_EMPTY UINT32_MAX /**< The slot has never been used. */
+#define ORDERED_INDEX_DELETED (UINT32_MAX - 1) /**< The slot referred to an entry that was removed. */
+
+/**
+ * @brief Number of entries an ordered hash table holds for a given index
+ * capacity, two thirds of it.
+ */
+#define ORDERED_USABLE_ENTRIES(index_capacity) ((index_capacity) * 2 / 3)
+
+/**
+ * @brief Largest number of entries of an ordered hash table, so that every
+ * entry offset fits in an index slot below the two markers.
+ */
+#define ORDERED_MAX_ENTRIES ((size_t)ORDERED_INDEX_DELETED)
+
+/**
+ * @brief A hash table keeping its entries in insertion order.
+ *
+ * @details Entries are appended to dense arrays in insertion order and never
+ * move until the next resize. The hash table itself is a small `index` array
+ * of entry offsets, probed linearly. A full scan walks the dense arrays, and
+ * a resize compacts the entries in place and rebuilds only the index from
+ * the stored hash codes. Removed entries stay in the arrays, marked in
+ * `removed`, until the next resize. Entries are stored inline or in nodes,
+ * with the same rule as `hash_table_t`.
+ *
+ * @param count Number of entries in the table.
+ * @param entry_count Number of used entries, including removed ones.
+ * @param index_capacity Number of index slots, a power of two.
+ * @param index Array of entry offsets, or ORDERED_INDEX_EMPTY /
+ * ORDERED_INDEX_DELETED.
+ * @param hashes Array of the full hash codes of the entries.
+ * @param removed Array of flags marking removed entries.
+ * @param storage The way entries are laid out.
+ * @param nodes Array of pointers to nodes (node storage only).
+ * @param keys Array of inline keys (flat storage only).
+ * @param values Array of inline values (flat storage only).
+ * @param key_manager A type manager for the keys.
+ * @param value_manager A type manager for the values.
+ * @param get_hash_code Function pointer to get hash codes.
+ */
+typedef struct ordered_hash_table_t {
+  size_t count; /**< Number of entries in the table. */
+  size_t entry_count; /**< Number of used entries, including removed ones. */
+  size_t index_capacity; /**< Number of index slots, a power of two. */
+  uint32_t *index; /**< Array of entry offsets. */
+  size_t *hashes; /**< Array of the full hash codes of the entries. */
+  uint8_t *removed; /**< Array of flags marking removed entries. */
+  hash_table_storage_t storage; /**< The way entries are laid out. */
+  hash_table_node_t **nodes; /**< Array of pointers to nodes (node storage only). */
+  char *keys; /**< Array of inline keys (flat storage only). */
+  char *values; /**< Array of inline values (flat storage only). */
+  type_manager_t key_manager; /**< A type manager for the keys. */
+  type_manager_t value_manager; /**< A type manager for the values. */
+
+  get_hash_code_t get_hash_code; /**< Function pointer to get hash codes. */
+} ordered_hash_table_t;
+
+#endif
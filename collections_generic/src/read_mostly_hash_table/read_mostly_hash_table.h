@@ -0,0 +1,8 @@
+#ifndef READ_MOSTLY_HASH_TABLE_H
+#define READ_MOSTLY_HASH_TABLE_H
+#include "../hash_table/hash_table.h"
+
+#include "read_mostly_hash_table_functions/base/base_functions.h"
+#include "types/read_mostly_hash_table_t.h"
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef BASE_FUNCTIONS_READ_MOSTLY_HASH_TABLE_H
+#define BASE_FUNCTIONS_READ_MOSTLY_HASH_TABLE_H
+
+#include "../../../hash_table/hash_table.h"
+#include "../../types/read_mostly_hash_table_t.h"
+
+/**
+ * Creates a new read-mostly hash table. The parameters are the same as for
+ * `create_hash_table`.
+ *
+ * @return a pointer to the newly created table, or NULL on failure
+ */
+read_mostly_hash_table_t *create_read_mostly_hash_table(
+    size_t key_size, copy_t key_copy, destruct_t key_destruct,
+    compare_t key_compare, size_t value_size, copy_t value_copy,
+    destruct_t value_destruct, compare_t value_compare);
+
+/**
+ * Deallocates all memory used by the given read-mostly hash table, including
+ * the table itself. No other thread may use the table at that point.
+ *
+ * @param table Pointer to the table to be deallocated.
+ */
+void destruct_read_mostly_hash_table(read_mostly_hash_table_t *table);
+
+/**
+ * @brief Sets the hash function of the keys, like `hash_table_t::get_hash_code`.
+ *
+ * @details Must be called before the table is shared between threads.
+ */
+void set_read_mostly_hash_table_get_hash_code(read_mostly_hash_table_t *table,
+                                              get_hash_code_t get_hash_code);
+
+/**
+ * @brief Copies the value associated with a key, like `get_from_hash_table`.
+ *
+ * @details Never takes a lock and never waits for writers.
+ *
+ * @return True if the key was found and the value was copied, false
+ * otherwise.
+ */
+bool_t get_from_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                       const void *key, void *data);
+
+/**
+ * @brief Checks if a key exists, like `contains_key`.
+ *
+ * @details Never takes a lock and never waits for writers.
+ */
+bool_t contains_key_in_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                              const void *key);
+
+/**
+ * @brief Starts a write and returns a private copy of the published table.
+ *
+ * @details Takes the write lock, so writes are serialized. The copy can be
+ * modified with any `hash_table_t` function, then published with
+ * `commit_read_mostly_hash_table_write` or dropped with
+ * `abort_read_mostly_hash_table_write`. Readers keep seeing the published
+ * table meanwhile.
+ *
+ * @return The copy, or NULL on failure (the write lock is released in that
+ * case).
+ */
+hash_table_t *begin_read_mostly_hash_table_write(
+    read_mostly_hash_table_t *table);
+
+/**
+ * @brief Publishes the copy returned by `begin_read_mostly_hash_table_write`
+ * and ends the write.
+ *
+ * @details Waits until no reader can still use the replaced table, then
+ * destructs it.
+ */
+void commit_read_mostly_hash_table_write(read_mostly_hash_table_t *table,
+                                         hash_table_t *copy);
+
+/**
+ * @brief Destructs the copy returned by `begin_read_mostly_hash_table_write`
+ * and ends the write without publishing anything.
+ */
+void abort_read_mostly_hash_table_write(read_mostly_hash_table_t *table,
+                                        hash_table_t *copy);
+
+/**
+ * @brief Adds a key-value pair in a write of its own, like
+ * `add_to_hash_table`.
+ *
+ * @return True if the pair was added, false if the key is already present or
+ * on failure.
+ */
+bool_t add_to_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                     const void *key, const void *data);
+
+/**
+ * @brief Replaces the value associated with a key in a write of its own,
+ * like `change_in_hash_table`.
+ *
+ * @return True if the key was found, false otherwise.
+ */
+bool_t change_in_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                        const void *key, const void *data);
+
+/**
+ * @brief Removes a key-value pair in a write of its own, like
+ * `remove_from_hash_table`.
+ *
+ * @return True if the key was found and removed, false otherwise.
+ */
+bool_t remove_from_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                          const void *key);
+
+#endif
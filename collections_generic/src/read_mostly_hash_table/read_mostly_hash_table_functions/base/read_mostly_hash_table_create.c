@@ -0,0 +1,51 @@
+#include "../../../support/validators.h"
+#include "base_functions.h"
+#include <stdlib.h>
+
+read_mostly_hash_table_t *create_read_mostly_hash_table(
+    size_t key_size, copy_t key_copy, destruct_t key_destruct,
+    compare_t key_compare, size_t value_size, copy_t value_copy,
+    destruct_t value_destruct, compare_t value_compare) {
+
+  if (NULL_ARGUMENT_CHECK(key_compare)) {
+    return NULL;
+  }
+
+  read_mostly_hash_table_t *table =
+      aligned_alloc(READ_MOSTLY_HASH_TABLE_CACHE_LINE,
+                    sizeof(read_mostly_hash_table_t));
+  if (MALLOC_FAILURE_CHECK(table)) {
+    return NULL;
+  }
+
+  hash_table_t *current = create_hash_table(
+      key_size, key_copy, key_destruct, key_compare, value_size, value_copy,
+      value_destruct, value_compare);
+  if (current == NULL) {
+    free(table);
+    return NULL;
+  }
+  if (pthread_mutex_init(&table->write_lock, NULL) != 0) {
+    destruct_hash_table(current);
+    free(table);
+    return NULL;
+  }
+
+  atomic_init(&table->current, current);
+  atomic_init(&table->epoch, 0);
+  for (size_t i = 0; i < READ_MOSTLY_HASH_TABLE_READER_STRIPES; i++) {
+    atomic_init(&table->readers[i].active[0], 0);
+    atomic_init(&table->readers[i].active[1], 0);
+  }
+
+  return table;
+}
+
+void set_read_mostly_hash_table_get_hash_code(read_mostly_hash_table_t *table,
+                                              get_hash_code_t get_hash_code) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return;
+  }
+
+  atomic_load(&table->current)->get_hash_code = get_hash_code;
+}
@@ -0,0 +1,11 @@
+#include "base_functions.h"
+#include <stdlib.h>
+
+void destruct_read_mostly_hash_table(read_mostly_hash_table_t *table) {
+  if (table == NULL)
+    return;
+
+  destruct_hash_table(atomic_load(&table->current));
+  pthread_mutex_destroy(&table->write_lock);
+  free(table);
+}
@@ -0,0 +1,58 @@
+#include "../../../support/validators.h"
+#include "base_functions.h"
+#include <stdint.h>
+
+static _Thread_local size_t reader_stripe = SIZE_MAX;
+static atomic_size_t next_reader_stripe;
+
+static size_t get_reader_stripe(void) {
+  if (reader_stripe == SIZE_MAX)
+    reader_stripe = atomic_fetch_add(&next_reader_stripe, 1) %
+                    READ_MOSTLY_HASH_TABLE_READER_STRIPES;
+  return reader_stripe;
+}
+
+/**
+ * @brief Registers the calling thread as a reader of the current epoch and
+ * returns the counter to decrement once the read is over.
+ *
+ * @details The epoch is checked again after the counter is incremented: a
+ * writer that replaced the table in between may already be waiting on the
+ * other counters only, so the registration is retried.
+ */
+static atomic_size_t *enter_read(read_mostly_hash_table_t *table) {
+  read_mostly_hash_table_readers_t *readers =
+      &table->readers[get_reader_stripe()];
+  for (;;) {
+    size_t epoch = atomic_load(&table->epoch);
+    atomic_size_t *active = &readers->active[epoch & 1];
+    atomic_fetch_add(active, 1);
+    if (atomic_load(&table->epoch) == epoch)
+      return active;
+    atomic_fetch_sub(active, 1);
+  }
+}
+
+bool_t get_from_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                       const void *key, void *data) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  atomic_size_t *active = enter_read(table);
+  bool_t result = get_from_hash_table(atomic_load(&table->current), key, data);
+  atomic_fetch_sub(active, 1);
+  return result;
+}
+
+bool_t contains_key_in_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                              const void *key) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(key)) {
+    return false;
+  }
+
+  atomic_size_t *active = enter_read(table);
+  bool_t result = contains_key(atomic_load(&table->current), key);
+  atomic_fetch_sub(active, 1);
+  return result;
+}
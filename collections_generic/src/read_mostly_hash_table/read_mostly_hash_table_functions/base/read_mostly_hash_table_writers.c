@@ -0,0 +1,95 @@
+#include "../../../support/validators.h"
+#include "base_functions.h"
+#include <sched.h>
+
+hash_table_t *begin_read_mostly_hash_table_write(
+    read_mostly_hash_table_t *table) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return NULL;
+  }
+
+  pthread_mutex_lock(&table->write_lock);
+  hash_table_t *copy = clone_hash_table(atomic_load(&table->current));
+  if (copy == NULL) {
+    pthread_mutex_unlock(&table->write_lock);
+  }
+  return copy;
+}
+
+static void wait_for_readers(read_mostly_hash_table_t *table, size_t parity) {
+  for (size_t i = 0; i < READ_MOSTLY_HASH_TABLE_READER_STRIPES; i++) {
+    while (atomic_load(&table->readers[i].active[parity]) != 0)
+      sched_yield();
+  }
+}
+
+void commit_read_mostly_hash_table_write(read_mostly_hash_table_t *table,
+                                         hash_table_t *copy) {
+  if (NULL_ARGUMENT_CHECK(table) || NULL_ARGUMENT_CHECK(copy)) {
+    return;
+  }
+
+  // readers entering the next epoch load the copy, only the readers of the
+  // current epoch may still use the replaced table
+  hash_table_t *replaced = atomic_exchange(&table->current, copy);
+  size_t epoch = atomic_fetch_add(&table->epoch, 1);
+  wait_for_readers(table, epoch & 1);
+  destruct_hash_table(replaced);
+
+  pthread_mutex_unlock(&table->write_lock);
+}
+
+void abort_read_mostly_hash_table_write(read_mostly_hash_table_t *table,
+                                        hash_table_t *copy) {
+  if (NULL_ARGUMENT_CHECK(table)) {
+    return;
+  }
+
+  destruct_hash_table(copy);
+  pthread_mutex_unlock(&table->write_lock);
+}
+
+bool_t add_to_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                     const void *key, const void *data) {
+  hash_table_t *copy = begin_read_mostly_hash_table_write(table);
+  if (copy == NULL) {
+    return false;
+  }
+
+  if (!add_to_hash_table(copy, key, data)) {
+    abort_read_mostly_hash_table_write(table, copy);
+    return false;
+  }
+  commit_read_mostly_hash_table_write(table, copy);
+  return true;
+}
+
+bool_t change_in_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                        const void *key, const void *data) {
+  hash_table_t *copy = begin_read_mostly_hash_table_write(table);
+  if (copy == NULL) {
+    return false;
+  }
+
+  if (!change_in_hash_table(copy, key, data)) {
+    abort_read_mostly_hash_table_write(table, copy);
+    return false;
+  }
+  commit_read_mostly_hash_table_write(table, copy);
+  return true;
+}
+
+bool_t remove_from_read_mostly_hash_table(read_mostly_hash_table_t *table,
+                                          const void *key) {
+  hash_table_t *copy = begin_read_mostly_hash_table_write(table);
+  if (copy == NULL) {
+    return false;
+  }
+
+  if (!remove_from_hash_table(copy, key)) {
+    abort_read_mostly_hash_table_write(table, copy);
+    return false;
+  }
+  commit_read_mostly_hash_table_write(table, copy);
+  return true;
+}
@@ -0,0 +1,50 @@
+#ifndef READ_MOSTLY_HASH_TABLE_T_H
+#define READ_MOSTLY_HASH_TABLE_T_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../../hash_table/types/hash_table.h"
+
+/**
+ * @brief Number of reader counters of a read-mostly hash table. Readers
+ * spread over them so that they do not write to the same cache line.
+ */
+#define READ_MOSTLY_HASH_TABLE_READER_STRIPES 32
+
+/**
+ * @brief Alignment of the reader counters.
+ */
+#define READ_MOSTLY_HASH_TABLE_CACHE_LINE 64
+
+/**
+ * @brief Counters of the readers inside a read, one per epoch parity.
+ */
+typedef struct read_mostly_hash_table_readers_t {
+  _Alignas(READ_MOSTLY_HASH_TABLE_CACHE_LINE) atomic_size_t active[2]; /**< Readers that entered during an even or odd epoch. */
+} read_mostly_hash_table_readers_t;
+
+/**
+ * @brief A hash table for data read from many threads and rarely modified.
+ *
+ * @details Readers never take a lock: they load the published table and read
+ * it while registered in the current epoch. Writers take `write_lock`, apply
+ * their changes to a private copy of the table and publish it with an atomic
+ * store. The replaced table is destructed once every reader that may still
+ * use it has left its epoch. Each write copies the whole table, so the table
+ * suits data updated a few times a minute; many changes can be grouped in a
+ * single write with `begin_read_mostly_hash_table_write`.
+ *
+ * @param current The table readers use.
+ * @param epoch Incremented every time a table is replaced.
+ * @param readers Reader counters, indexed by the parity of `epoch`.
+ * @param write_lock Serializes writers.
+ */
+typedef struct read_mostly_hash_table_t {
+  _Atomic(hash_table_t *) current; /**< The table readers use. */
+  atomic_size_t epoch; /**< Incremented every time a table is replaced. */
+  read_mostly_hash_table_readers_t readers[READ_MOSTLY_HASH_TABLE_READER_STRIPES]; /**< Reader counters. */
+  pthread_mutex_t write_lock; /**< Serializes writers. */
+} read_mostly_hash_table_t;
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef TYPED_HASH_TABLE_H
+#define TYPED_HASH_TABLE_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../hash_table/hash_table_functions/common/hash.h"
+#include "../hash_table/probe_functions/control_group.h"
+#include "../hash_table/probe_functions/probing.h"
+#include "../hash_table/types/hash_table.h"
+#include "../support/validators.h"
+
+/**
+ * @brief Declares a hash table type specialized for the given key and value
+ * types, with `static inline` operations.
+ *
+ * @details The generated table lays out slots like a flat, group-probed
+ * `hash_table_t` and follows its semantics: `add` does not replace the value
+ * of an existing key, `remove` leaves deleted slots behind only in full
+ * groups, and the table grows past `REHASH_THRESHOLD` and rehashes when
+ * deleted slots pile up. Keys and values are stored and passed by value and
+ * copied by assignment, so they must not own memory. Hash codes are seeded
+ * per table and mixed with `mix_hash_code`.
+ *
+ * Since the key type is known and `hash_fn` and `eq_fn` are called directly,
+ * the compiler inlines them into the probe loop, where `hash_table_t` calls
+ * `get_hash_code`, `compare` and `copy` through pointers and copies keys and
+ * values with `memcpy` of a runtime size.
+ *
+ * For example `DECLARE_HASH_TABLE(int_float_map, int, float, hash_int,
+ * equal_ints)` declares `int_float_map_t` and functions such as
+ * `int_float_map_add(map, key, value)`.
+ *
+ * @param name Prefix of the declared type (`name##_t`) and functions.
+ * @param key_type Type of the keys.
+ * @param value_type Type of the values.
+ * @param hash_fn Function or macro taking a `key_type` and returning its hash
+ * code as an integer.
+ * @param eq_fn Function or macro taking two `key_type` and returning non-zero
+ * if they are equal.
+ */
+#define DECLARE_HASH_TABLE(name, key_type, value_type, hash_fn, eq_fn)         \
+  typedef struct name##_t {                                                    \
+    size_t capacity;                                                           \
+    size_t count;                                                              \
+    size_t count_with_deleted;                                                 \
+    size_t hash_seed;                                                          \
+    uint8_t *controls;                                                         \
+    key_type *keys;                                                            \
+    value_type *values;                                                        \
+  } name##_t;                                                                  \
+                                                                               \
+  static inline size_t name##_hash(const name##_t *table, key_type key) {      \
+    return (size_t)mix_hash_code((uint64_t)(hash_fn(key)) ^ table->hash_seed); \
+  }                                                                            \
+                                                                               \
+  static inline bool_t name##_allocate(name##_t *table, size_t capacity) {     \
+    uint8_t *controls = calloc(capacity, 1);                                   \
+    key_type *keys = calloc(capacity, sizeof(key_type));                       \
+    value_type *values = calloc(capacity, sizeof(value_type));                 \
+    if (MALLOC_FAILURE_CHECK(controls) || MALLOC_FAILURE_CHECK(keys) ||        \
+        MALLOC_FAILURE_CHECK(values)) {                                        \
+      free(controls);                                                          \
+      free(keys);                                                              \
+      free(values);                                                            \
+      return false;                                                            \
+    }                                                                          \
+    memset(controls, SLOT_EMPTY, capacity);                                    \
+    table->capacity = capacity;                                                \
+    table->count_with_deleted = 0;                                             \
+    table->controls = controls;                                                \
+    table->keys = keys;                                                        \
+    table->values = values;                                                    \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  /* Returns the slot of the key, or the capacity if it is missing. */         \
+  static inline size_t name##_find(const name##_t *table, key_type key,        \
+                                   size_t hash) {                              \
+    size_t index_mask = table->capacity / HASH_TABLE_GROUP_SIZE - 1;           \
+    size_t group = hash & index_mask;                                          \
+    uint8_t fingerprint = get_fingerprint(hash);                               \
+    for (size_t i = 0; i <= index_mask; i++) {                                 \
+      size_t first_slot = group * HASH_TABLE_GROUP_SIZE;                       \
+      const uint8_t *controls = table->controls + first_slot;                  \
+      for (group_mask_t hits = match_control(controls, fingerprint);           \
+           hits != 0; hits &= hits - 1) {                                      \
+        size_t slot = first_slot + lowest_bit(hits);                           \
+        if (eq_fn(table->keys[slot], key))                                     \
+          return slot;                                                         \
+      }                                                                        \
+      if (match_empty(controls) != 0)                                          \
+        return table->capacity;                                                \
+      group = (group + i + 1) & index_mask;                                    \
+    }                                                                          \
+    return table->capacity;                                                    \
+  }                                                                            \
+                                                                               \
+  /* Returns the first free slot of the probe sequence, or the capacity. */    \
+  static inline size_t name##_find_free(const name##_t *table, size_t hash) {  \
+    size_t index_mask = table->capacity / HASH_TABLE_GROUP_SIZE - 1;           \
+    size_t group = hash & index_mask;                                          \
+    for (size_t i = 0; i <= index_mask; i++) {                                 \
+      size_t first_slot = group * HASH_TABLE_GROUP_SIZE;                       \
+      group_mask_t free_mask = match_free(table->controls + first_slot);       \
+      if (free_mask != 0)                                                      \
+        return first_slot + lowest_bit(free_mask);                             \
+      group = (group + i + 1) & index_mask;                                    \
+    }                                                                          \
+    return table->capacity;                                                    \
+  }                                                                            \
+                                                                               \
+  static inline bool_t name##_rebuild(name##_t *table, size_t capacity) {      \
+    name##_t old = *table;                                                     \
+    if (!name##_allocate(table, capacity))                                     \
+      return false;                                                            \
+    for (size_t i = 0; i < old.capacity; i++) {                                \
+      if (!IS_SLOT_OCCUPIED(old.controls[i]))                                  \
+        continue;                                                              \
+      size_t hash = name##_hash(table, old.keys[i]);                           \
+      size_t slot = name##_find_free(table, hash);                             \
+      table->controls[slot] = get_fingerprint(hash);                           \
+      table->keys[slot] = old.keys[i];                                         \
+      table->values[slot] = old.values[i];                                     \
+      table->count_with_deleted++;                                             \
+    }                                                                          \
+    free(old.controls);                                                        \
+    free(old.keys);                                                            \
+    free(old.values);                                                          \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  /**                                                                          \
+   * @brief Creates a table sized to hold `expected_count` entries without     \
+   * growing, like `create_hash_table_with_capacity`.                          \
+   */                                                                          \
+  static inline name##_t *name##_create_with_capacity(size_t expected_count) { \
+    name##_t *table = calloc(1, sizeof(name##_t));                             \
+    if (MALLOC_FAILURE_CHECK(table))                                           \
+      return NULL;                                                             \
+    size_t capacity = DEFAULT_HASH_TABLE_SIZE;                                 \
+    while (expected_count > capacity * REHASH_THRESHOLD)                       \
+      capacity *= RESIZE_FACTOR;                                               \
+    if (!name##_allocate(table, capacity)) {                                   \
+      free(table);                                                             \
+      return NULL;                                                             \
+    }                                                                          \
+    table->hash_seed = (size_t)generate_hash_seed();                           \
+    return table;                                                              \
+  }                                                                            \
+                                                                               \
+  /** @brief Creates an empty table, like `create_hash_table`. */              \
+  static inline name##_t *name##_create(void) {                                \
+    return name##_create_with_capacity(0);                                     \
+  }                                                                            \
+                                                                               \
+  /** @brief Frees the table, like `destruct_hash_table`. */                   \
+  static inline void name##_destruct(name##_t *table) {                        \
+    if (table == NULL)                                                         \
+      return;                                                                  \
+    free(table->controls);                                                     \
+    free(table->keys);                                                         \
+    free(table->values);                                                       \
+    free(table);                                                               \
+  }                                                                            \
+                                                                               \
+  /**                                                                          \
+   * @brief Adds an entry, like `add_to_hash_table`.                           \
+   * @return True if the key was added, false if it was already present or on  \
+   * allocation failure.                                                       \
+   */                                                                          \
+  static inline bool_t name##_add(name##_t *table, key_type key,             \
+                                  value_type value) {                          \
+    if (table->count > table->capacity * REHASH_THRESHOLD)                     \
+      name##_rebuild(table, table->capacity * RESIZE_FACTOR);                  \
+    else if (table->count_with_deleted > table->count * RESIZE_FACTOR)         \
+      name##_rebuild(table, table->capacity);                                  \
+                                                                               \
+    size_t hash = name##_hash(table, key);                                     \
+    if (name##_find(table, key, hash) < table->capacity)                       \
+      return false;                                                            \
+    size_t slot = name##_find_free(table, hash);                               \
+    if (slot == table->capacity) {                                             \
+      if (!name##_rebuild(table, table->capacity * RESIZE_FACTOR))             \
+        return false;                                                          \
+      slot = name##_find_free(table, hash);                                    \
+    }                                                                          \
+    if (table->controls[slot] == SLOT_EMPTY)                                   \
+      table->count_with_deleted++;                                             \
+    table->controls[slot] = get_fingerprint(hash);                             \
+    table->keys[slot] = key;                                                   \
+    table->values[slot] = value;                                               \
+    table->count++;                                                            \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  /**                                                                          \
+   * @brief Returns a pointer to the value of a key, valid until the next      \
+   * insertion or removal, or NULL if the key is missing.                      \
+   */                                                                          \
+  static inline value_type *name##_get_pointer(const name##_t *table,          \
+                                            key_type key) {                    \
+    size_t slot = name##_find(table, key, name##_hash(table, key));            \
+    return slot < table->capacity ? &table->values[slot] : NULL;               \
+  }                                                                            \
+                                                                               \
+  /** @brief Copies the value of a key, like `get_from_hash_table`. */         \
+  static inline bool_t name##_get(const name##_t *table, key_type key,         \
+                                  value_type *value) {                         \
+    value_type *stored = name##_get_pointer(table, key);                       \
+    if (stored == NULL)                                                        \
+      return false;                                                            \
+    *value = *stored;                                                          \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief Checks if a key is present, like `contains_key`. */               \
+  static inline bool_t name##_contains(const name##_t *table, key_type key) {  \
+    return name##_get_pointer(table, key) != NULL;                             \
+  }                                                                            \
+                                                                               \
+  /** @brief Replaces the value of a key, like `change_in_hash_table`. */      \
+  static inline bool_t name##_change(name##_t *table, key_type key,            \
+                                     value_type value) {                       \
+    value_type *stored = name##_get_pointer(table, key);                       \
+    if (stored == NULL)                                                        \
+      return false;                                                            \
+    *stored = value;                                                           \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief Removes a key, like `remove_from_hash_table`. */                  \
+  static inline bool_t name##_remove(name##_t *table, key_type key) {          \
+    size_t slot = name##_find(table, key, name##_hash(table, key));            \
+    if (slot == table->capacity)                                               \
+      return false;                                                            \
+    const uint8_t *group = table->controls + slot / HASH_TABLE_GROUP_SIZE *    \
+                                                 HASH_TABLE_GROUP_SIZE;        \
+    if (match_empty(group) != 0) {                                             \
+      table->controls[slot] = SLOT_EMPTY;                                      \
+      table->count_with_deleted--;                                             \
+    } else {                                                                   \
+      table->controls[slot] = SLOT_DELETED;                                    \
+    }                                                                          \
+    table->count--;                                                            \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  /* a declaration, so that the macro is used with a trailing semicolon */     \
+  typedef name##_t name##_t
+
+#endif
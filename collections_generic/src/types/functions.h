@@ -10,6 +10,7 @@ typedef void (*copy_t)(const void *, void *);
 typedef bool_t (*predicate_t)(const void *);
 
 typedef void *(*create_t)(void);
+typedef void (*update_t)(void *value, void *context);
 
 typedef size_t (*get_hash_code_t)(size_t capacity, size_t key_gen,
                                  const void *key);
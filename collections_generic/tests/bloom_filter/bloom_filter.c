@@ -0,0 +1,82 @@
+#include "../types/user_type_string/string.h"
+#include "bloom_filter_tests.h"
+
+#include <stdio.h>
+
+START_TEST(test_bloom_filter_int_keys) {
+  bloom_filter_t *filter = create_bloom_filter(10000, 0.01, sizeof(int), NULL);
+  ck_assert_ptr_nonnull(filter);
+  ck_assert_uint_eq(filter->block_count & (filter->block_count - 1), 0);
+
+  for (int key = 0; key < 10000; key++) {
+    add_to_bloom_filter(filter, &key);
+  }
+  ck_assert_uint_eq(filter->count, 10000);
+
+  // No false negatives, and about 1% of false positives
+  for (int key = 0; key < 10000; key++) {
+    ck_assert_int_eq(true, contains_in_bloom_filter(filter, &key));
+  }
+  size_t false_positives = 0;
+  for (int key = 10000; key < 110000; key++) {
+    false_positives += contains_in_bloom_filter(filter, &key);
+  }
+  ck_assert_uint_lt(false_positives, 2000);
+
+  clear_bloom_filter(filter);
+  ck_assert_uint_eq(filter->count, 0);
+  int key = 42;
+  ck_assert_int_eq(false, contains_in_bloom_filter(filter, &key));
+
+  destruct_bloom_filter(filter);
+}
+END_TEST
+
+START_TEST(test_bloom_filter_string_keys) {
+  bloom_filter_t *filter =
+      create_bloom_filter(100, 0.01, sizeof(string_t),
+                          (get_hash_code_t)get_hash_code_string);
+  ck_assert_ptr_nonnull(filter);
+
+  char buffer[32];
+  for (int i = 0; i < 100; i++) {
+    snprintf(buffer, sizeof(buffer), "key %d", i);
+    string_t *key = create_string(buffer);
+    add_to_bloom_filter(filter, key);
+    destroy_string(key);
+  }
+
+  // Equal strings hash alike whatever their address
+  size_t found = 0;
+  for (int i = 0; i < 200; i++) {
+    snprintf(buffer, sizeof(buffer), "key %d", i);
+    string_t *key = create_string(buffer);
+    bool_t contained = contains_in_bloom_filter(filter, key);
+    if (i < 100)
+      ck_assert_int_eq(true, contained);
+    found += contained;
+    destroy_string(key);
+  }
+  ck_assert_uint_lt(found, 120);
+
+  destruct_bloom_filter(filter);
+}
+END_TEST
+
+START_TEST(test_bloom_filter_invalid_rate) {
+  ck_assert_ptr_null(create_bloom_filter(100, 0, sizeof(int), NULL));
+  ck_assert_ptr_null(create_bloom_filter(100, 1, sizeof(int), NULL));
+}
+END_TEST
+
+Suite *create_test_suite_bloom_filter(void) {
+  Suite *suite = suite_create("Bloom Filter Tests");
+
+  TCase *tcase_base = tcase_create("Base functions of Bloom Filter");
+  tcase_add_test(tcase_base, test_bloom_filter_int_keys);
+  tcase_add_test(tcase_base, test_bloom_filter_string_keys);
+  tcase_add_test(tcase_base, test_bloom_filter_invalid_rate);
+  suite_add_tcase(suite, tcase_base);
+
+  return suite;
+}
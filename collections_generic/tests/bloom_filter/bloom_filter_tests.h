@@ -0,0 +1,8 @@
+#ifndef BLOOM_FILTER_TESTS_H
+#define BLOOM_FILTER_TESTS_H
+
+#include "../../src/bloom_filter/bloom_filter.h"
+#include <check.h>
+Suite *create_test_suite_bloom_filter(void);
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef CONCURRENT_HASH_TABLE_TESTS_H
+#define CONCURRENT_HASH_TABLE_TESTS_H
+
+#include "../../src/concurrent_hash_table/concurrent_hash_table.h"
+#include "../../src/read_mostly_hash_table/read_mostly_hash_table.h"
+#include <check.h>
+Suite *create_test_suite_concurrent_hash_table_int_key_int_value(void);
+Suite *create_test_suite_read_mostly_hash_table_int_key_int_value(void);
+
+#endif
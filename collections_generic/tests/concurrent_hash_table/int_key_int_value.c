@@ -0,0 +1,204 @@
+#include "../types/int/int.h"
+#include "concurrent_hash_table_tests.h"
+
+#include <pthread.h>
+
+#define THREAD_COUNT 8
+#define KEYS_PER_THREAD 20000
+#define SHARED_KEY_COUNT 16
+
+static concurrent_hash_table_t *create_int_table(void) {
+  return create_concurrent_hash_table(0, sizeof(int), NULL, NULL,
+                                      (compare_t)compare_ints, sizeof(int),
+                                      NULL, NULL, NULL);
+}
+
+START_TEST(test_concurrent_hash_table_single_thread) {
+  concurrent_hash_table_t *table = create_int_table();
+  ck_assert_ptr_nonnull(table);
+  ck_assert_uint_eq(table->shard_count, CONCURRENT_HASH_TABLE_DEFAULT_SHARDS);
+
+  for (int key = 0; key < 1000; key++) {
+    int value = key * 2;
+    ck_assert_int_eq(true, add_to_concurrent_hash_table(table, &key, &value));
+  }
+  int key = 10;
+  int value = 0;
+  ck_assert_int_eq(false, add_to_concurrent_hash_table(table, &key, &value));
+  ck_assert_uint_eq(count_in_concurrent_hash_table(table), 1000);
+
+  ck_assert_int_eq(true, get_from_concurrent_hash_table(table, &key, &value));
+  ck_assert_int_eq(value, 20);
+  value = 7;
+  ck_assert_int_eq(true, change_in_concurrent_hash_table(table, &key, &value));
+  ck_assert_int_eq(true, get_from_concurrent_hash_table(table, &key, &value));
+  ck_assert_int_eq(value, 7);
+
+  ck_assert_int_eq(true, remove_from_concurrent_hash_table(table, &key));
+  ck_assert_int_eq(false, contains_key_in_concurrent_hash_table(table, &key));
+  ck_assert_uint_eq(count_in_concurrent_hash_table(table), 999);
+
+  destruct_concurrent_hash_table(table);
+}
+END_TEST
+
+typedef struct worker_t {
+  concurrent_hash_table_t *table;
+  int id;
+  size_t misses;
+} worker_t;
+
+static void increment_int(void *value, void *context) {
+  (void)context;
+  (*(int *)value)++;
+}
+
+static void *add_get_and_count(void *argument) {
+  worker_t *worker = argument;
+  int first = worker->id * KEYS_PER_THREAD;
+  int zero = 0;
+  for (int key = first; key < first + KEYS_PER_THREAD; key++) {
+    int value = key;
+    if (!add_to_concurrent_hash_table(worker->table, &key, &value))
+      worker->misses++;
+
+    int retrieved_value;
+    if (!get_from_concurrent_hash_table(worker->table, &key,
+                                        &retrieved_value) ||
+        retrieved_value != key)
+      worker->misses++;
+
+    // every thread also bumps the same few counters
+    int shared_key = -1 - key % SHARED_KEY_COUNT;
+    if (!update_in_concurrent_hash_table_with(worker->table, &shared_key,
+                                              &zero, increment_int, NULL))
+      worker->misses++;
+  }
+  return NULL;
+}
+
+START_TEST(test_concurrent_hash_table_reseeded_shards) {
+  concurrent_hash_table_t *table = create_int_table();
+  ck_assert_ptr_nonnull(table);
+
+  // Shards start with the shard seed, the hash selecting them probes them
+  for (size_t i = 0; i < table->shard_count; i++) {
+    ck_assert_uint_eq(table->shards[i].table->hash_seed, table->shard_seed);
+  }
+  for (int key = 0; key < 1000; key++) {
+    ck_assert_int_eq(true, add_to_concurrent_hash_table(table, &key, &key));
+  }
+
+  // A shard drawing its own seed hashes its keys again
+  for (size_t i = 0; i < table->shard_count; i += 2) {
+    ck_assert_int_eq(true, set_hash_table_seed(table->shards[i].table,
+                                               table->shard_seed + 1));
+  }
+  for (int key = 0; key < 1000; key++) {
+    int value = -1;
+    ck_assert_int_eq(true, get_from_concurrent_hash_table(table, &key, &value));
+    ck_assert_int_eq(value, key);
+  }
+  int key = 1000;
+  ck_assert_int_eq(true, add_to_concurrent_hash_table(table, &key, &key));
+  for (key = 0; key <= 1000; key++) {
+    ck_assert_int_eq(true, remove_from_concurrent_hash_table(table, &key));
+  }
+  ck_assert_uint_eq(count_in_concurrent_hash_table(table), 0);
+
+  destruct_concurrent_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_concurrent_hash_table_many_threads) {
+  concurrent_hash_table_t *table = create_int_table();
+  ck_assert_ptr_nonnull(table);
+
+  pthread_t threads[THREAD_COUNT];
+  worker_t workers[THREAD_COUNT];
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    workers[i] = (worker_t){table, i, 0};
+    ck_assert_int_eq(
+        pthread_create(&threads[i], NULL, add_get_and_count, &workers[i]), 0);
+  }
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    pthread_join(threads[i], NULL);
+    ck_assert_uint_eq(workers[i].misses, 0);
+  }
+
+  ck_assert_uint_eq(count_in_concurrent_hash_table(table),
+                    THREAD_COUNT * KEYS_PER_THREAD + SHARED_KEY_COUNT);
+  for (int key = 0; key < THREAD_COUNT * KEYS_PER_THREAD; key++) {
+    int retrieved_value;
+    ck_assert_int_eq(true,
+                     get_from_concurrent_hash_table(table, &key,
+                                                    &retrieved_value));
+    ck_assert_int_eq(retrieved_value, key);
+  }
+  for (int i = 0; i < SHARED_KEY_COUNT; i++) {
+    int shared_key = -1 - i;
+    int counter;
+    ck_assert_int_eq(true,
+                     get_from_concurrent_hash_table(table, &shared_key,
+                                                    &counter));
+    ck_assert_int_eq(counter,
+                     THREAD_COUNT * KEYS_PER_THREAD / SHARED_KEY_COUNT);
+  }
+
+  destruct_concurrent_hash_table(table);
+}
+END_TEST
+
+static void *get_all_keys(void *argument) {
+  worker_t *worker = argument;
+  for (int round = 0; round < 4; round++) {
+    for (int key = 0; key < KEYS_PER_THREAD; key++) {
+      int retrieved_value;
+      if (!get_from_concurrent_hash_table(worker->table, &key,
+                                          &retrieved_value))
+        worker->misses++;
+    }
+  }
+  return NULL;
+}
+
+START_TEST(test_concurrent_hash_table_concurrent_reads) {
+  concurrent_hash_table_t *table = create_int_table();
+  ck_assert_ptr_nonnull(table);
+  for (int key = 0; key < KEYS_PER_THREAD; key++) {
+    ck_assert_int_eq(true, add_to_concurrent_hash_table(table, &key, &key));
+  }
+
+  // Readers sharing the stripes all find every key
+  pthread_t threads[THREAD_COUNT];
+  worker_t workers[THREAD_COUNT];
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    workers[i] = (worker_t){table, i, 0};
+    ck_assert_int_eq(
+        pthread_create(&threads[i], NULL, get_all_keys, &workers[i]), 0);
+  }
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    pthread_join(threads[i], NULL);
+    ck_assert_uint_eq(workers[i].misses, 0);
+  }
+
+  destruct_concurrent_hash_table(table);
+}
+END_TEST
+
+Suite *create_test_suite_concurrent_hash_table_int_key_int_value(void) {
+  Suite *suite = suite_create("Concurrent Hash Table Tests");
+
+  TCase *tcase_base = tcase_create("Base functions of Concurrent Hash Table");
+  tcase_add_test(tcase_base, test_concurrent_hash_table_single_thread);
+  tcase_add_test(tcase_base, test_concurrent_hash_table_reseeded_shards);
+  suite_add_tcase(suite, tcase_base);
+
+  TCase *tcase_threads = tcase_create("Threads in Concurrent Hash Table");
+  tcase_set_timeout(tcase_threads, 60);
+  tcase_add_test(tcase_threads, test_concurrent_hash_table_many_threads);
+  tcase_add_test(tcase_threads, test_concurrent_hash_table_concurrent_reads);
+  suite_add_tcase(suite, tcase_threads);
+
+  return suite;
+}
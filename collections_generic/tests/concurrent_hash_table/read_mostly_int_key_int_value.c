@@ -0,0 +1,181 @@
+#include "../types/int/int.h"
+#include "concurrent_hash_table_tests.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define READER_COUNT 4
+#define KEY_COUNT 2000
+#define VERSION_COUNT 50
+
+static read_mostly_hash_table_t *create_int_table(void) {
+  return create_read_mostly_hash_table(sizeof(int), NULL, NULL,
+                                       (compare_t)compare_ints, sizeof(int),
+                                       NULL, NULL, NULL);
+}
+
+START_TEST(test_read_mostly_hash_table_single_thread) {
+  read_mostly_hash_table_t *table = create_int_table();
+  ck_assert_ptr_nonnull(table);
+
+  int key = 5;
+  int value = 50;
+  ck_assert_int_eq(true, add_to_read_mostly_hash_table(table, &key, &value));
+  ck_assert_int_eq(false, add_to_read_mostly_hash_table(table, &key, &value));
+  value = 0;
+  ck_assert_int_eq(true, get_from_read_mostly_hash_table(table, &key, &value));
+  ck_assert_int_eq(value, 50);
+
+  value = 51;
+  ck_assert_int_eq(true, change_in_read_mostly_hash_table(table, &key, &value));
+  ck_assert_int_eq(true, get_from_read_mostly_hash_table(table, &key, &value));
+  ck_assert_int_eq(value, 51);
+
+  // Several changes published at once
+  hash_table_t *copy = begin_read_mostly_hash_table_write(table);
+  ck_assert_ptr_nonnull(copy);
+  for (int other_key = 100; other_key < 200; other_key++) {
+    ck_assert_int_eq(true, add_to_hash_table(copy, &other_key, &other_key));
+  }
+  int other_key = 150;
+  ck_assert_int_eq(false,
+                   contains_key_in_read_mostly_hash_table(table, &other_key));
+  commit_read_mostly_hash_table_write(table, copy);
+  ck_assert_int_eq(true,
+                   contains_key_in_read_mostly_hash_table(table, &other_key));
+
+  ck_assert_int_eq(true, remove_from_read_mostly_hash_table(table, &key));
+  ck_assert_int_eq(false, remove_from_read_mostly_hash_table(table, &key));
+  ck_assert_int_eq(false, contains_key_in_read_mostly_hash_table(table, &key));
+
+  destruct_read_mostly_hash_table(table);
+}
+END_TEST
+
+typedef struct reader_t {
+  read_mostly_hash_table_t *table;
+  atomic_bool *stop;
+  size_t reads;
+  size_t errors;
+} reader_t;
+
+static void *read_consistent_versions(void *argument) {
+  reader_t *reader = argument;
+  while (!atomic_load(reader->stop) || reader->reads == 0) {
+    for (int key = 0; key < KEY_COUNT; key++) {
+      int value;
+      // every published version maps each key to a multiple of it
+      if (!get_from_read_mostly_hash_table(reader->table, &key, &value) ||
+          (key != 0 && value % key != 0))
+        reader->errors++;
+      reader->reads++;
+    }
+  }
+  return NULL;
+}
+
+START_TEST(test_read_mostly_hash_table_readers_during_writes) {
+  read_mostly_hash_table_t *table = create_int_table();
+  ck_assert_ptr_nonnull(table);
+  hash_table_t *copy = begin_read_mostly_hash_table_write(table);
+  for (int key = 0; key < KEY_COUNT; key++) {
+    ck_assert_int_eq(true, add_to_hash_table(copy, &key, &key));
+  }
+  commit_read_mostly_hash_table_write(table, copy);
+
+  atomic_bool stop;
+  atomic_init(&stop, false);
+  pthread_t threads[READER_COUNT];
+  reader_t readers[READER_COUNT];
+  for (int i = 0; i < READER_COUNT; i++) {
+    readers[i] = (reader_t){table, &stop, 0, 0};
+    ck_assert_int_eq(pthread_create(&threads[i], NULL,
+                                    read_consistent_versions, &readers[i]),
+                     0);
+  }
+
+  // Each version replaces every value, and grows the table on the way
+  for (int version = 2; version <= VERSION_COUNT; version++) {
+    copy = begin_read_mostly_hash_table_write(table);
+    ck_assert_ptr_nonnull(copy);
+    for (int key = 0; key < KEY_COUNT; key++) {
+      int value = key * version;
+      ck_assert_int_eq(true, change_in_hash_table(copy, &key, &value));
+    }
+    int extra_key = KEY_COUNT + version;
+    ck_assert_int_eq(true, add_to_hash_table(copy, &extra_key, &extra_key));
+    commit_read_mostly_hash_table_write(table, copy);
+  }
+
+  atomic_store(&stop, true);
+  for (int i = 0; i < READER_COUNT; i++) {
+    pthread_join(threads[i], NULL);
+    ck_assert_uint_gt(readers[i].reads, 0);
+    ck_assert_uint_eq(readers[i].errors, 0);
+  }
+
+  int key = KEY_COUNT - 1;
+  int value;
+  ck_assert_int_eq(true, get_from_read_mostly_hash_table(table, &key, &value));
+  ck_assert_int_eq(value, key * VERSION_COUNT);
+
+  destruct_read_mostly_hash_table(table);
+}
+END_TEST
+
+static void *read_all_keys(void *argument) {
+  reader_t *reader = argument;
+  for (int round = 0; round < 20; round++) {
+    for (int key = 0; key < KEY_COUNT; key++) {
+      int value;
+      if (!get_from_read_mostly_hash_table(reader->table, &key, &value))
+        reader->errors++;
+      reader->reads++;
+    }
+  }
+  return NULL;
+}
+
+START_TEST(test_read_mostly_hash_table_concurrent_reads) {
+  read_mostly_hash_table_t *table = create_int_table();
+  ck_assert_ptr_nonnull(table);
+  hash_table_t *copy = begin_read_mostly_hash_table_write(table);
+  for (int key = 0; key < KEY_COUNT; key++) {
+    ck_assert_int_eq(true, add_to_hash_table(copy, &key, &key));
+  }
+  commit_read_mostly_hash_table_write(table, copy);
+
+  // Readers sharing one version all find every key
+  pthread_t threads[READER_COUNT];
+  reader_t readers[READER_COUNT];
+  for (int i = 0; i < READER_COUNT; i++) {
+    readers[i] = (reader_t){table, NULL, 0, 0};
+    ck_assert_int_eq(
+        pthread_create(&threads[i], NULL, read_all_keys, &readers[i]), 0);
+  }
+  for (int i = 0; i < READER_COUNT; i++) {
+    pthread_join(threads[i], NULL);
+    ck_assert_uint_eq(readers[i].errors, 0);
+    ck_assert_uint_eq(readers[i].reads, 20 * KEY_COUNT);
+  }
+
+  destruct_read_mostly_hash_table(table);
+}
+END_TEST
+
+Suite *create_test_suite_read_mostly_hash_table_int_key_int_value(void) {
+  Suite *suite = suite_create("Read-Mostly Hash Table Tests");
+
+  TCase *tcase_base = tcase_create("Base functions of Read-Mostly Hash Table");
+  tcase_add_test(tcase_base, test_read_mostly_hash_table_single_thread);
+  suite_add_tcase(suite, tcase_base);
+
+  TCase *tcase_threads = tcase_create("Threads in Read-Mostly Hash Table");
+  tcase_set_timeout(tcase_threads, 60);
+  tcase_add_test(tcase_threads,
+                 test_read_mostly_hash_table_readers_during_writes);
+  tcase_add_test(tcase_threads, test_read_mostly_hash_table_concurrent_reads);
+  suite_add_tcase(suite, tcase_threads);
+
+  return suite;
+}
@@ -0,0 +1,98 @@
+#include "../types/int/int.h"
+#include "../types/user_type_string/string.h"
+#include "hash_set_tests.h"
+
+static hash_set_t *create_int_set(int first, int last, int step) {
+  hash_set_t *set =
+      create_hash_set(sizeof(int), NULL, NULL, (compare_t)compare_ints);
+  for (int key = first; key < last; key += step)
+    add_to_hash_set(set, &key);
+  return set;
+}
+
+START_TEST(test_hash_set_base_functions) {
+  hash_set_t *set =
+      create_hash_set(sizeof(int), NULL, NULL, (compare_t)compare_ints);
+  ck_assert_ptr_nonnull(set);
+  ck_assert_int_eq(set->table->storage, FLAT_STORAGE);
+  ck_assert_uint_eq(set->table->value_manager.size_of_obj, 0);
+
+  for (int key = 0; key < 1000; key++) {
+    ck_assert_int_eq(true, add_to_hash_set(set, &key));
+  }
+  int key = 10;
+  ck_assert_int_eq(false, add_to_hash_set(set, &key));
+  ck_assert_int_eq(true, contains_in_hash_set(set, &key));
+  ck_assert_uint_eq(count_in_hash_set(set), 1000);
+
+  ck_assert_int_eq(true, remove_from_hash_set(set, &key));
+  ck_assert_int_eq(false, remove_from_hash_set(set, &key));
+  ck_assert_int_eq(false, contains_in_hash_set(set, &key));
+  ck_assert_uint_eq(count_in_hash_set(set), 999);
+
+  destruct_hash_set(set);
+}
+END_TEST
+
+START_TEST(test_hash_set_string_keys) {
+  hash_set_t *set =
+      create_hash_set(sizeof(string_t), (copy_t)copy_string,
+                      (destruct_t)destroy_string, (compare_t)compare_strings);
+  ck_assert_ptr_nonnull(set);
+  set_hash_set_get_hash_code(set, (get_hash_code_t)get_hash_code_string);
+
+  string_t *key = create_string("dedup");
+  ck_assert_int_eq(true, add_to_hash_set(set, key));
+  ck_assert_int_eq(false, add_to_hash_set(set, key));
+  ck_assert_int_eq(true, contains_in_hash_set(set, key));
+  destroy_string(key);
+
+  destruct_hash_set(set);
+}
+END_TEST
+
+START_TEST(test_hash_set_operations) {
+  // multiples of 2 and of 3 below 600
+  hash_set_t *evens = create_int_set(0, 600, 2);
+  hash_set_t *triples = create_int_set(0, 600, 3);
+
+  hash_set_t *both = intersect_hash_sets(evens, triples);
+  hash_set_t *either = union_hash_sets(evens, triples);
+  hash_set_t *evens_only = difference_hash_sets(evens, triples);
+  ck_assert_ptr_nonnull(both);
+  ck_assert_ptr_nonnull(either);
+  ck_assert_ptr_nonnull(evens_only);
+
+  ck_assert_uint_eq(count_in_hash_set(both), 100);
+  ck_assert_uint_eq(count_in_hash_set(either), 400);
+  ck_assert_uint_eq(count_in_hash_set(evens_only), 200);
+  for (int key = 0; key < 600; key++) {
+    bool_t even = key % 2 == 0;
+    bool_t triple = key % 3 == 0;
+    ck_assert_int_eq(contains_in_hash_set(both, &key), even && triple);
+    ck_assert_int_eq(contains_in_hash_set(either, &key), even || triple);
+    ck_assert_int_eq(contains_in_hash_set(evens_only, &key), even && !triple);
+  }
+
+  destruct_hash_set(both);
+  destruct_hash_set(either);
+  destruct_hash_set(evens_only);
+  destruct_hash_set(evens);
+  destruct_hash_set(triples);
+}
+END_TEST
+
+Suite *create_test_suite_hash_set(void) {
+  Suite *suite = suite_create("Hash Set Tests");
+
+  TCase *tcase_base = tcase_create("Base functions of Hash Set");
+  tcase_add_test(tcase_base, test_hash_set_base_functions);
+  tcase_add_test(tcase_base, test_hash_set_string_keys);
+  suite_add_tcase(suite, tcase_base);
+
+  TCase *tcase_operations = tcase_create("Operations on Hash Sets");
+  tcase_add_test(tcase_operations, test_hash_set_operations);
+  suite_add_tcase(suite, tcase_operations);
+
+  return suite;
+}
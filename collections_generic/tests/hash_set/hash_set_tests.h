@@ -0,0 +1,8 @@
+#ifndef HASH_SET_TESTS_H
+#define HASH_SET_TESTS_H
+
+#include "../../src/hash_set/hash_set.h"
+#include <check.h>
+Suite *create_test_suite_hash_set(void);
+
+#endif
@@ -1,5 +1,15 @@
+#include "../../src/bloom_filter/bloom_filter.h"
 #include "../types/int/int.h"
+#include "../../src/hash_table/hash_table_functions/common/get_hash_code.h"
+#include "../../src/hash_table/hash_table_functions/common/hash.h"
+#include "../../src/hash_table/hash_table_functions/common/parallel_rebuild.h"
+#include "../../src/hash_table/hash_table_functions/common/rebuild_slots.h"
+#include "../../src/hash_table/probe_functions/probe_functions.h"
 #include "hash_table_tests.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #define ACCURACY 1e-6
 
 START_TEST(test_add_to_hash_table_existing_key) {
@@ -219,6 +229,775 @@ START_TEST(test_remove_from_hash_table_non_existing_key) {
 }
 END_TEST
 
+START_TEST(test_flat_storage_many_keys) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  ck_assert_int_eq(table->storage, FLAT_STORAGE);
+
+  // Enough keys to force several resizes
+  for (int key = 0; key < 1000; key++) {
+    float value = key * 0.5f;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  ck_assert_uint_eq(table->count, 1000);
+
+  for (int key = 0; key < 1000; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, key * 0.5f, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_power_of_two_capacity_many_keys) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  const int key_count = 1 << 20;
+  for (int key = 0; key < key_count; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  ck_assert_uint_eq(table->count, key_count);
+  // probe positions are masked, so the capacity must stay a power of two
+  ck_assert_uint_eq(table->capacity & (table->capacity - 1), 0);
+
+  for (int key = 0; key < key_count; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, key, ACCURACY);
+  }
+  int missing_key = key_count;
+  float retrieved_value;
+  ck_assert_int_eq(false,
+                   get_from_hash_table(table, &missing_key, &retrieved_value));
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_add_after_remove_other_key) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  // Remove every key, then add new keys that may reuse the deleted slots
+  for (int key = 0; key < 50; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  for (int key = 0; key < 50; key++) {
+    ck_assert_int_eq(true, remove_from_hash_table(table, &key));
+  }
+  for (int key = 100; key < 150; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+
+  for (int key = 0; key < 50; key++) {
+    ck_assert_int_eq(false, contains_key(table, &key));
+  }
+  for (int key = 100; key < 150; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, key, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+static size_t compare_calls = 0;
+
+static int counting_compare_ints(const int *a, const int *b) {
+  compare_calls++;
+  return compare_ints(a, b);
+}
+
+START_TEST(test_negative_lookups_skip_compare) {
+  hash_table_t *table = create_hash_table(
+      sizeof(int), NULL, NULL, (compare_t)counting_compare_ints, sizeof(float),
+      NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  for (int key = 0; key < 1000; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+
+  // Fingerprints reject almost every occupied slot on a miss
+  compare_calls = 0;
+  for (int key = 1000; key < 2000; key++) {
+    ck_assert_int_eq(false, contains_key(table, &key));
+  }
+  ck_assert_uint_lt(compare_calls, 1000);
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_filtered_hash_table) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->incremental_resize = true;
+  ck_assert_int_eq(true, set_hash_table_filter(table, true));
+  ck_assert_ptr_nonnull(table->filter);
+
+  // The filter follows resizes, incremental or not
+  for (int key = 0; key < 5000; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  for (int key = 0; key < 10000; key++) {
+    ck_assert_int_eq(contains_key(table, &key), key < 5000);
+  }
+
+  // Removed keys stay in the filter until it is refilled
+  for (int key = 0; key < 4900; key++) {
+    ck_assert_int_eq(true, remove_from_hash_table(table, &key));
+  }
+  ck_assert_uint_le(table->filter->count,
+                    table->count * 2 + DEFAULT_HASH_TABLE_SIZE);
+  for (int key = 0; key < 5000; key++) {
+    float value;
+    ck_assert_int_eq(get_from_hash_table(table, &key, &value), key >= 4900);
+  }
+
+  hash_table_t *clone = clone_hash_table(table);
+  ck_assert_ptr_nonnull(clone);
+  ck_assert_ptr_nonnull(clone->filter);
+  for (int key = 0; key < 5000; key++) {
+    ck_assert_int_eq(contains_key(clone, &key), key >= 4900);
+  }
+  destruct_hash_table(clone);
+
+  ck_assert_int_eq(true, set_hash_table_seed(table, 0));
+  ck_assert_int_eq(true, set_hash_table_filter(table, false));
+  ck_assert_ptr_null(table->filter);
+  ck_assert_int_eq(true, set_hash_table_filter(table, true));
+  for (int key = 0; key < 5000; key++) {
+    ck_assert_int_eq(contains_key(table, &key), key >= 4900);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_robin_hood_cancel_insert_slot) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  ck_assert_int_eq(true, set_hash_table_probing(table, ROBIN_HOOD_PROBING));
+  for (int key = 0; key < 90; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+
+  // Slots freed in front of a run are given back unfilled, as when
+  // allocating a node fails
+  size_t shifted_runs = 0;
+  for (int new_key = 1000; new_key < 1100; new_key++) {
+    size_t index;
+    uint8_t control;
+    ck_assert_int_eq(true, prepare_insert_slot(
+                               table, &new_key,
+                               get_full_hash_code(table, &new_key), &index,
+                               &control));
+    size_t next = (index + 1) & (table->capacity - 1);
+    shifted_runs += IS_SLOT_OCCUPIED(table->controls[next]);
+    cancel_insert_slot(table, index);
+    ck_assert_int_eq(false, contains_key(table, &new_key));
+  }
+  ck_assert_uint_gt(shifted_runs, 0);
+
+  for (int key = 0; key < 90; key++) {
+    float value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &value));
+    ck_assert_float_eq_tol(value, key, ACCURACY);
+  }
+  ck_assert_uint_eq(table->count, 90);
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_set_probing_during_migration) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->incremental_resize = true;
+
+  int count = 0;
+  while (table->migration_source == NULL) {
+    float value = count;
+    ck_assert_int_eq(true, add_to_hash_table(table, &count, &value));
+    count++;
+  }
+
+  // The migration ends before the slots are laid out for the new probing
+  ck_assert_int_eq(true, set_hash_table_probing(table, ROBIN_HOOD_PROBING));
+  ck_assert_ptr_null(table->migration_source);
+  for (int key = 0; key < count; key++) {
+    float value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &value));
+    ck_assert_float_eq_tol(value, key, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_robin_hood_churn) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  ck_assert_int_eq(true, set_hash_table_probing(table, ROBIN_HOOD_PROBING));
+
+  // Insert and remove at the same rate, keeping 100 live keys
+  for (int key = 0; key < 5000; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+    if (key >= 100) {
+      int old_key = key - 100;
+      ck_assert_int_eq(true, remove_from_hash_table(table, &old_key));
+    }
+  }
+
+  // Removal never leaves deleted slots behind
+  ck_assert_uint_eq(table->count, 100);
+  ck_assert_uint_eq(table->count_with_deleted, table->count);
+
+  for (int key = 0; key < 5000; key++) {
+    float retrieved_value;
+    bool_t expected = key >= 4900 ? true : false;
+    ck_assert_int_eq(expected,
+                     get_from_hash_table(table, &key, &retrieved_value));
+    if (expected)
+      ck_assert_float_eq_tol(retrieved_value, key, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_iterate_and_export_hash_table) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->incremental_resize = true;
+
+  // Stop in the middle of a migration, entries live in both slot arrays
+  int count = 0;
+  while (table->migration_source == NULL || count < 120) {
+    float value = count;
+    ck_assert_int_eq(true, add_to_hash_table(table, &count, &value));
+    count++;
+  }
+  ck_assert_ptr_nonnull(table->migration_source);
+  for (int key = 0; key < count; key += 3) {
+    ck_assert_int_eq(true, remove_from_hash_table(table, &key));
+  }
+
+  char *seen = calloc(count, 1);
+  size_t position = 0;
+  size_t visited = 0;
+  key_value_pair_t pair;
+  while (next_in_hash_table(table, &position, &pair)) {
+    int key = *(int *)pair.key;
+    ck_assert_int_ne(key % 3, 0);
+    ck_assert_int_eq(seen[key], 0);
+    ck_assert_float_eq_tol(*(float *)pair.value, key, ACCURACY);
+    seen[key] = 1;
+    visited++;
+  }
+  ck_assert_uint_eq(visited, table->count);
+  ck_assert_int_eq(false, next_in_hash_table(table, &position, &pair));
+
+  // The export follows the iteration order
+  int *keys = calloc(table->count, sizeof(int));
+  float *values = calloc(table->count, sizeof(float));
+  ck_assert_uint_eq(hash_table_export(table, keys, values, table->count),
+                    table->count);
+  position = 0;
+  for (size_t i = 0; i < table->count; i++) {
+    ck_assert_int_eq(true, next_in_hash_table(table, &position, &pair));
+    ck_assert_int_eq(keys[i], *(int *)pair.key);
+    ck_assert_float_eq_tol(values[i], keys[i], ACCURACY);
+  }
+
+  // Arrays too small receive as many entries as fit
+  int *few_keys = calloc(10, sizeof(int));
+  ck_assert_uint_eq(hash_table_export(table, few_keys, NULL, 10), 10);
+  ck_assert_int_eq(0, memcmp(few_keys, keys, 10 * sizeof(int)));
+
+  free(few_keys);
+  free(keys);
+  free(values);
+  free(seen);
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_incremental_resize) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->incremental_resize = true;
+
+  bool_t saw_migration = false;
+  for (int key = 0; key < 3000; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+    if (table->migration_source != NULL) {
+      saw_migration = true;
+      // Keys added before the resize stay visible during the migration
+      int first_key = 0;
+      ck_assert_int_eq(true, contains_key(table, &first_key));
+      ck_assert_int_eq(false, add_to_hash_table(table, &first_key, &value));
+    }
+  }
+  ck_assert_int_eq(true, saw_migration);
+  ck_assert_uint_eq(table->count, 3000);
+
+  for (int key = 0; key < 3000; key += 2) {
+    ck_assert_int_eq(true, remove_from_hash_table(table, &key));
+  }
+  for (int key = 0; key < 3000; key++) {
+    float retrieved_value;
+    bool_t expected = key % 2 == 1 ? true : false;
+    ck_assert_int_eq(expected,
+                     get_from_hash_table(table, &key, &retrieved_value));
+    if (expected)
+      ck_assert_float_eq_tol(retrieved_value, key, ACCURACY);
+  }
+  ck_assert_uint_eq(table->count, 1500);
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_upsert_in_hash_table) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  // Sum values per key through the returned value pointer
+  for (int i = 0; i < 3000; i++) {
+    int key = i % 1000;
+    bool_t inserted = false;
+    float *value = upsert_in_hash_table(table, &key, NULL, &inserted);
+    ck_assert_ptr_nonnull(value);
+    ck_assert_int_eq(inserted, i < 1000);
+    *value += 0.5f;
+  }
+  ck_assert_uint_eq(table->count, 1000);
+
+  for (int key = 0; key < 1000; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, 1.5f, ACCURACY);
+  }
+
+  // An existing value is not overwritten by the value passed in
+  int key = 7;
+  float other = 100.0f;
+  float *value = upsert_in_hash_table(table, &key, &other, NULL);
+  ck_assert_float_eq_tol(*value, 1.5f, ACCURACY);
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_get_many_from_hash_table) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  for (int key = 0; key < 1000; key += 2) {
+    float value = key * 0.5f;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+
+  // More keys than a batch, half of them missing
+  int keys[100];
+  float values[100];
+  bool_t found_mask[100];
+  for (int i = 0; i < 100; i++) {
+    keys[i] = 400 + i;
+    values[i] = -1.0f;
+  }
+  ck_assert_uint_eq(get_many_from_hash_table(table, keys, 100, values,
+                                             found_mask),
+                    50);
+
+  for (int i = 0; i < 100; i++) {
+    ck_assert_int_eq(found_mask[i], keys[i] % 2 == 0);
+    float expected = found_mask[i] ? keys[i] * 0.5f : -1.0f;
+    ck_assert_float_eq_tol(values[i], expected, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_create_with_capacity_does_not_resize) {
+  hash_table_t *table = create_hash_table_with_capacity(
+      10000, sizeof(int), NULL, NULL, (compare_t)compare_ints, sizeof(float),
+      NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  size_t capacity = table->capacity;
+
+  for (int key = 0; key < 10000; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  ck_assert_uint_eq(table->capacity, capacity);
+
+  // Reserving less than the current capacity keeps the table as it is
+  ck_assert_int_eq(true, reserve_in_hash_table(table, 100));
+  ck_assert_uint_eq(table->capacity, capacity);
+  ck_assert_int_eq(true, reserve_in_hash_table(table, 100000));
+  ck_assert_uint_gt(table->capacity, capacity);
+  ck_assert_uint_eq(table->count, 10000);
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_add_many_to_hash_table) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  int existing_key = 3;
+  float existing_value = -1.0f;
+  ck_assert_int_eq(true,
+                   add_to_hash_table(table, &existing_key, &existing_value));
+
+  enum { KEY_COUNT = 5000 };
+  static int keys[KEY_COUNT];
+  static float values[KEY_COUNT];
+  for (int i = 0; i < KEY_COUNT; i++) {
+    keys[i] = i;
+    values[i] = i * 0.5f;
+  }
+  ck_assert_uint_eq(add_many_to_hash_table(table, keys, values, KEY_COUNT),
+                    KEY_COUNT - 1);
+  ck_assert_uint_eq(table->count, KEY_COUNT);
+
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    float expected = key == existing_key ? existing_value : key * 0.5f;
+    ck_assert_float_eq_tol(retrieved_value, expected, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_hash_table_snapshot) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  ck_assert_int_eq(true, set_hash_table_probing(table, ROBIN_HOOD_PROBING));
+
+  enum { KEY_COUNT = 3000 };
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key * 0.25f;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+
+  char path[] = "/tmp/hash_table_snapshot_XXXXXX";
+  int file = mkstemp(path);
+  ck_assert_int_ge(file, 0);
+  close(file);
+  ck_assert_int_eq(true, write_hash_table_snapshot(table, path));
+  destruct_hash_table(table);
+
+  hash_table_t *snapshot =
+      open_hash_table_snapshot(path, (compare_t)compare_ints, NULL, NULL);
+  unlink(path);
+  ck_assert_ptr_nonnull(snapshot);
+  ck_assert_uint_eq(snapshot->count, KEY_COUNT);
+
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(snapshot, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, key * 0.25f, ACCURACY);
+  }
+  int missing_key = KEY_COUNT;
+  ck_assert_int_eq(false, contains_key(snapshot, &missing_key));
+
+  // slots that never held an entry are written as zeros
+  for (size_t i = 0; i < snapshot->capacity; i++) {
+    if (snapshot->controls[i] != SLOT_EMPTY)
+      continue;
+    int empty_key;
+    float empty_value;
+    memcpy(&empty_key, snapshot->keys + i * sizeof(int), sizeof(int));
+    memcpy(&empty_value, snapshot->values + i * sizeof(float), sizeof(float));
+    ck_assert_int_eq(empty_key, 0);
+    ck_assert_float_eq(empty_value, 0.0f);
+  }
+
+  // the slots are mapped read-only
+  float value = 1.0f;
+  ck_assert_int_eq(false, add_to_hash_table(snapshot, &missing_key, &value));
+  ck_assert_int_eq(false, remove_from_hash_table(snapshot, &missing_key));
+  ck_assert_uint_eq(snapshot->count, KEY_COUNT);
+
+  destruct_hash_table(snapshot);
+}
+END_TEST
+
+START_TEST(test_hash_table_stats) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  enum { KEY_COUNT = 1000, REMOVED_COUNT = 100 };
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  for (int key = 0; key < REMOVED_COUNT; key++) {
+    ck_assert_int_eq(true, remove_from_hash_table(table, &key));
+  }
+
+  hash_table_stats_t stats;
+  ck_assert_int_eq(true, hash_table_stats(table, &stats));
+  ck_assert_uint_eq(stats.capacity, table->capacity);
+  ck_assert_uint_eq(stats.count, KEY_COUNT - REMOVED_COUNT);
+  ck_assert_uint_eq(stats.tombstones, table->count_with_deleted - table->count);
+
+  size_t histogram_total = 0;
+  for (size_t i = 0; i < HASH_TABLE_STATS_HISTOGRAM_SIZE; i++)
+    histogram_total += stats.probe_length_histogram[i];
+  ck_assert_uint_eq(histogram_total, stats.count);
+  ck_assert_uint_ge(stats.max_probe_length, 1);
+  ck_assert(stats.mean_probe_length >= 1.0);
+  ck_assert(stats.mean_probe_length <= stats.max_probe_length);
+#ifdef HASH_TABLE_STATS
+  ck_assert_uint_gt(stats.counters.resize_count, 0);
+#else
+  ck_assert_uint_eq(stats.counters.resize_count, 0);
+#endif
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+/**
+ * Collides every key while unseeded, like keys crafted against a known hash,
+ * and spreads them once the table passes a seed as key_gen.
+ */
+static size_t flooded_get_hash_code(size_t capacity, size_t key_gen,
+                                    const int *key) {
+  (void)capacity;
+  if (key_gen == HASH_TABLE_KEY_GEN)
+    return 0;
+  return (size_t)*key * key_gen;
+}
+
+START_TEST(test_seeded_hash_of_secret_first_word) {
+  // A first word equal to the secret it is XORed with must not zero the
+  // product and drop the seed and the other words
+  uint64_t first[2] = {0xe7037ed1a0b428dbULL, 1};
+  uint64_t second[2] = {0xe7037ed1a0b428dbULL, 2};
+  uint64_t seeds[3] = {0, 1, 0x9e3779b97f4a7c15ULL};
+  for (int i = 0; i < 3; i++) {
+    ck_assert_uint_ne(hash_bytes(first, sizeof(first), seeds[i]),
+                      hash_bytes(second, sizeof(second), seeds[i]));
+    ck_assert_uint_ne(hash_bytes(first, sizeof(first), seeds[i]),
+                      hash_bytes(first, sizeof(first), seeds[(i + 1) % 3]));
+  }
+}
+END_TEST
+
+START_TEST(test_reseed_on_long_probes) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)flooded_get_hash_code;
+  ck_assert_int_eq(true, set_hash_table_seed(table, 0));
+
+  enum { KEY_COUNT = 2000 };
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  ck_assert_uint_ne(table->hash_seed, 0);
+
+  hash_table_stats_t stats;
+  ck_assert_int_eq(true, hash_table_stats(table, &stats));
+  ck_assert_uint_lt(stats.max_probe_length, 8);
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, key, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_parallel_resize) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->resize_threads = 4;
+
+  enum { KEY_COUNT = 4 * HASH_TABLE_PARALLEL_RESIZE_MIN };
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key * 0.5f;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  ck_assert_uint_ge(table->capacity, 2 * HASH_TABLE_PARALLEL_RESIZE_MIN);
+  ck_assert_uint_eq(table->count, KEY_COUNT);
+  ck_assert_uint_eq(table->count_with_deleted, KEY_COUNT);
+
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, key * 0.5f, ACCURACY);
+  }
+  int missing_key = KEY_COUNT;
+  ck_assert_int_eq(false, contains_key(table, &missing_key));
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_parallel_resize_out_of_slots) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  hash_table_t *small =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  ck_assert_ptr_nonnull(small);
+  small->resize_threads = 4;
+
+  enum { KEY_COUNT = HASH_TABLE_PARALLEL_RESIZE_MIN };
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  ck_assert_uint_ge(table->capacity, HASH_TABLE_PARALLEL_RESIZE_MIN);
+
+  // The threads run out of slots: nothing is written past the new slots,
+  // which are handed back empty, and the old ones are left intact
+  ck_assert_int_eq(false, relocate_entries_in_parallel(table, small));
+  ck_assert_uint_eq(small->count_with_deleted, 0);
+  for (size_t i = 0; i < small->capacity; i++) {
+    ck_assert_int_eq(small->controls[i], SLOT_EMPTY);
+  }
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &value));
+    ck_assert_float_eq_tol(value, key, ACCURACY);
+  }
+
+  destruct_hash_table(small);
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_rebuild_out_of_slots) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  enum { KEY_COUNT = 4 * HASH_TABLE_GROUP_SIZE };
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  size_t capacity = table->capacity;
+
+  // The entries do not fit: the rebuild fails and the old slots are kept
+  ck_assert_int_eq(false, rebuild_slots(table, HASH_TABLE_GROUP_SIZE));
+  ck_assert_uint_eq(table->capacity, capacity);
+  ck_assert_uint_eq(table->count, KEY_COUNT);
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &value));
+    ck_assert_float_eq_tol(value, key, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_shrink_hash_table) {
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+
+  enum { KEY_COUNT = 10000, KEPT_COUNT = 500 };
+  for (int key = 0; key < KEY_COUNT; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  size_t peak_capacity = table->capacity;
+  for (int key = KEPT_COUNT; key < KEY_COUNT; key++) {
+    ck_assert_int_eq(true, remove_from_hash_table(table, &key));
+  }
+  ck_assert_uint_eq(table->capacity, peak_capacity);
+
+  ck_assert_int_eq(true, shrink_hash_table(table));
+  ck_assert_uint_lt(table->capacity, peak_capacity);
+  ck_assert_uint_le(table->count, table->capacity * REHASH_THRESHOLD);
+  ck_assert_uint_eq(table->count_with_deleted, KEPT_COUNT);
+  for (int key = 0; key < KEY_COUNT; key++) {
+    ck_assert_int_eq(key < KEPT_COUNT, contains_key(table, &key));
+  }
+
+  // with auto_shrink the removals shrink the table on their own
+  table->auto_shrink = true;
+  for (int key = KEPT_COUNT; key < KEY_COUNT; key++) {
+    float value = key;
+    ck_assert_int_eq(true, add_to_hash_table(table, &key, &value));
+  }
+  for (int key = KEPT_COUNT; key < KEY_COUNT; key++) {
+    ck_assert_int_eq(true, remove_from_hash_table(table, &key));
+  }
+  ck_assert_uint_lt(table->capacity, peak_capacity);
+  for (int key = 0; key < KEPT_COUNT; key++) {
+    float retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, &key, &retrieved_value));
+    ck_assert_float_eq_tol(retrieved_value, key, ACCURACY);
+  }
+
+  destruct_hash_table(table);
+}
+END_TEST
+
 Suite *create_test_suite_hash_table_int_key_float_value(void) {
   Suite *suite = suite_create("Hash Table Tests");
 
@@ -226,11 +1005,14 @@ Suite *create_test_suite_hash_table_int_key_float_value(void) {
   TCase *tcase_add = tcase_create("Add in hash table");
   tcase_add_test(tcase_add, test_add_to_hash_table_existing_key);
   tcase_add_test(tcase_add, test_add_to_hash_table_duplicate_key);
+  tcase_add_test(tcase_add, test_create_with_capacity_does_not_resize);
+  tcase_add_test(tcase_add, test_add_many_to_hash_table);
   suite_add_tcase(suite, tcase_add);
 
   TCase *tcase_get_value = tcase_create("Get Value from Hash Table");
   tcase_add_test(tcase_get_value, test_get_from_hash_table_existing_key);
   tcase_add_test(tcase_get_value, test_get_from_hash_table_non_existing_key);
+  tcase_add_test(tcase_get_value, test_get_many_from_hash_table);
   suite_add_tcase(suite, tcase_get_value);
 
   TCase *tcase_change_value = tcase_create("Change Value in Hash Table");
@@ -243,7 +1025,38 @@ Suite *create_test_suite_hash_table_int_key_float_value(void) {
   tcase_add_test(tcase_remove_value, test_remove_from_hash_table);
   tcase_add_test(tcase_remove_value,
                  test_remove_from_hash_table_non_existing_key);
+  tcase_add_test(tcase_remove_value, test_shrink_hash_table);
   suite_add_tcase(suite, tcase_remove_value);
 
+  TCase *tcase_storage = tcase_create("Flat storage in Hash Table");
+  tcase_add_test(tcase_storage, test_flat_storage_many_keys);
+  tcase_add_test(tcase_storage, test_power_of_two_capacity_many_keys);
+  tcase_add_test(tcase_storage, test_add_after_remove_other_key);
+  tcase_add_test(tcase_storage, test_incremental_resize);
+  tcase_add_test(tcase_storage, test_parallel_resize);
+  tcase_add_test(tcase_storage, test_parallel_resize_out_of_slots);
+  tcase_add_test(tcase_storage, test_rebuild_out_of_slots);
+  tcase_add_test(tcase_storage, test_iterate_and_export_hash_table);
+  suite_add_tcase(suite, tcase_storage);
+
+  TCase *tcase_probing = tcase_create("Probing in Hash Table");
+  tcase_add_test(tcase_probing, test_negative_lookups_skip_compare);
+  tcase_add_test(tcase_probing, test_filtered_hash_table);
+  tcase_add_test(tcase_probing, test_robin_hood_churn);
+  tcase_add_test(tcase_probing, test_set_probing_during_migration);
+  tcase_add_test(tcase_probing, test_robin_hood_cancel_insert_slot);
+  tcase_add_test(tcase_probing, test_hash_table_stats);
+  tcase_add_test(tcase_probing, test_reseed_on_long_probes);
+  tcase_add_test(tcase_probing, test_seeded_hash_of_secret_first_word);
+  suite_add_tcase(suite, tcase_probing);
+
+  TCase *tcase_upsert = tcase_create("Upsert in Hash Table");
+  tcase_add_test(tcase_upsert, test_upsert_in_hash_table);
+  suite_add_tcase(suite, tcase_upsert);
+
+  TCase *tcase_snapshot = tcase_create("Snapshot of Hash Table");
+  tcase_add_test(tcase_snapshot, test_hash_table_snapshot);
+  suite_add_tcase(suite, tcase_snapshot);
+
   return suite;
 }
@@ -1,6 +1,8 @@
 #include "../types/user_type_string/string.h"
 #include "hash_table_tests.h"
 
+#include <stdio.h>
+
 START_TEST(test_add_to_hash_table_existing_key) {
   hash_table_t *table = create_hash_table(
       sizeof(string_t), (copy_t)copy_string, (destruct_t)destroy_string,
@@ -20,12 +22,13 @@ START_TEST(test_add_to_hash_table_existing_key) {
   ck_assert_int_eq(exists, true);
 
   int retrieved_value;
-  bool_t get_result = get_from_hash_table(table, &key, &retrieved_value);
+  bool_t get_result = get_from_hash_table(table, key, &retrieved_value);
   ck_assert_int_eq(get_result, true);
   ck_assert_int_eq(retrieved_value, value);
 
   // Destroy the hash table
   destruct_hash_table(table);
+  destroy_string(key);
 }END_TEST
 
 START_TEST(test_add_to_hash_table_duplicate_key)
@@ -331,6 +334,256 @@ START_TEST(test_remove_from_hash_table_non_existing_key)
 }
 END_TEST
 
+START_TEST(test_robin_hood_keeps_existing_entries)
+{
+  // Create a hash table
+  hash_table_t *table = create_hash_table(
+    sizeof(string_t), (copy_t)copy_string, (destruct_t)destroy_string,
+    (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+
+  string_t *key1 = create_string("first");
+  string_t *key2 = create_string("second");
+  int value1 = 1;
+  int value2 = 2;
+  ck_assert_int_eq(true, add_to_hash_table(table, key1, &value1));
+  ck_assert_int_eq(true, add_to_hash_table(table, key2, &value2));
+
+  // Switch probing with entries already in the table
+  ck_assert_int_eq(true, set_hash_table_probing(table, ROBIN_HOOD_PROBING));
+  ck_assert_int_eq(true, contains_key(table, key1));
+
+  ck_assert_int_eq(true, remove_from_hash_table(table, key1));
+  ck_assert_int_eq(false, contains_key(table, key1));
+
+  int retrieved_value;
+  ck_assert_int_eq(true, get_from_hash_table(table, key2, &retrieved_value));
+  ck_assert_int_eq(value2, retrieved_value);
+
+  // Destroy the hash table and keys
+  destruct_hash_table(table);
+  destroy_string(key1);
+  destroy_string(key2);
+}
+END_TEST
+
+START_TEST(test_incremental_resize_destruct_during_migration)
+{
+  // Create a hash table
+  hash_table_t *table = create_hash_table(
+    sizeof(string_t), (copy_t)copy_string, (destruct_t)destroy_string,
+    (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+  table->incremental_resize = true;
+
+  // Add keys until a migration starts
+  char buffer[32];
+  int i = 0;
+  while (table->migration_source == NULL) {
+    snprintf(buffer, sizeof(buffer), "key_%d", i);
+    string_t *key = create_string(buffer);
+    ck_assert_int_eq(true, add_to_hash_table(table, key, &i));
+    destroy_string(key);
+    i++;
+  }
+
+  // Every key is still reachable, whichever slots it is in
+  for (int j = 0; j < i; j++) {
+    snprintf(buffer, sizeof(buffer), "key_%d", j);
+    string_t *key = create_string(buffer);
+    int retrieved_value;
+    ck_assert_int_eq(true, get_from_hash_table(table, key, &retrieved_value));
+    ck_assert_int_eq(j, retrieved_value);
+    destroy_string(key);
+  }
+
+  // Destroy the hash table with entries in both slot arrays
+  destruct_hash_table(table);
+}
+END_TEST
+
+static size_t copy_calls = 0;
+
+static void counting_copy_string(const string_t *src, string_t *dest) {
+  copy_calls++;
+  copy_string(src, dest);
+}
+
+START_TEST(test_resize_does_not_copy_keys)
+{
+  // Create a hash table
+  hash_table_t *table = create_hash_table(
+    sizeof(string_t), (copy_t)counting_copy_string, (destruct_t)destroy_string,
+    (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+
+  // Enough keys to force several resizes
+  copy_calls = 0;
+  char buffer[32];
+  for (int i = 0; i < 1000; i++) {
+    snprintf(buffer, sizeof(buffer), "key_%d", i);
+    string_t *key = create_string(buffer);
+    ck_assert_int_eq(true, add_to_hash_table(table, key, &i));
+    destroy_string(key);
+  }
+
+  // Each key was copied once, on insertion
+  ck_assert_uint_eq(copy_calls, 1000);
+
+  // Destroy the hash table
+  destruct_hash_table(table);
+}
+END_TEST
+
+static size_t hash_calls = 0;
+
+static size_t counting_get_hash_code_string(size_t capacity, size_t key_gen,
+                                            const string_t *key) {
+  hash_calls++;
+  return get_hash_code_string(capacity, key_gen, key);
+}
+
+START_TEST(test_resize_does_not_hash_keys_again)
+{
+  // Create a hash table
+  hash_table_t *table = create_hash_table(
+    sizeof(string_t), (copy_t)copy_string, (destruct_t)destroy_string,
+    (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)counting_get_hash_code_string;
+
+  // Enough keys to force several resizes
+  hash_calls = 0;
+  char buffer[32];
+  for (int i = 0; i < 1000; i++) {
+    snprintf(buffer, sizeof(buffer), "key_%d", i);
+    string_t *key = create_string(buffer);
+    ck_assert_int_eq(true, add_to_hash_table(table, key, &i));
+    destroy_string(key);
+  }
+
+  // Each key was hashed once, on insertion
+  ck_assert_uint_eq(hash_calls, 1000);
+
+  // Destroy the hash table
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_export_copies_keys)
+{
+  // Create a hash table
+  hash_table_t *table = create_hash_table(
+    sizeof(string_t), (copy_t)copy_string, (destruct_t)destroy_string,
+    (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+
+  char buffer[32];
+  for (int i = 0; i < 100; i++) {
+    snprintf(buffer, sizeof(buffer), "key_%d", i);
+    string_t *key = create_string(buffer);
+    ck_assert_int_eq(true, add_to_hash_table(table, key, &i));
+    destroy_string(key);
+  }
+
+  // Exported keys are copies, they outlive the table
+  string_t keys[100];
+  int values[100];
+  ck_assert_uint_eq(hash_table_export(table, keys, values, 100), 100);
+  destruct_hash_table(table);
+
+  for (int i = 0; i < 100; i++) {
+    snprintf(buffer, sizeof(buffer), "key_%d", values[i]);
+    ck_assert_str_eq(keys[i].string, buffer);
+    free(keys[i].string);
+  }
+}
+END_TEST
+
+static void increment_int(void *value, void *context) {
+  (void)context;
+  (*(int *)value)++;
+}
+
+START_TEST(test_update_in_hash_table_with_counts_words)
+{
+  // Create a hash table
+  hash_table_t *table = create_hash_table(
+    sizeof(string_t), (copy_t)counting_copy_string, (destruct_t)destroy_string,
+    (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+
+  const char *words[] = {"apple", "pear", "apple", "plum", "apple", "pear"};
+  copy_calls = 0;
+  int zero = 0;
+  for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+    string_t *key = create_string(words[i]);
+    ck_assert_int_eq(true, update_in_hash_table_with(table, key, &zero,
+                                                     increment_int, NULL));
+    destroy_string(key);
+  }
+
+  // Only new words were copied into the table
+  ck_assert_uint_eq(copy_calls, 3);
+  ck_assert_uint_eq(table->count, 3);
+
+  string_t *key = create_string("apple");
+  int count = 0;
+  ck_assert_int_eq(true, get_from_hash_table(table, key, &count));
+  ck_assert_int_eq(count, 3);
+  destroy_string(key);
+
+  key = create_string("plum");
+  ck_assert_int_eq(true, get_from_hash_table(table, key, &count));
+  ck_assert_int_eq(count, 1);
+  destroy_string(key);
+
+  // Destroy the hash table
+  destruct_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_borrowed_lookups_do_not_copy)
+{
+  // Create a hash table
+  hash_table_t *table = create_hash_table(
+    sizeof(string_t), (copy_t)counting_copy_string, (destruct_t)destroy_string,
+    (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+
+  string_t *key = create_string("borrowed");
+  int value = 42;
+  ck_assert_int_eq(true, add_to_hash_table(table, key, &value));
+
+  copy_calls = 0;
+  const int *retrieved_value = get_pointer_from_hash_table(table, key);
+  ck_assert_ptr_nonnull(retrieved_value);
+  ck_assert_int_eq(*retrieved_value, 42);
+
+  key_value_pair_t pair;
+  ck_assert_int_eq(true, get_key_value_pair_from_hash_table(table, key, &pair));
+  ck_assert_int_eq(compare_strings(pair.key, key), 0);
+  ck_assert_ptr_eq(pair.value, retrieved_value);
+  ck_assert_uint_eq(copy_calls, 0);
+
+  string_t *missing_key = create_string("missing");
+  ck_assert_ptr_null(get_pointer_from_hash_table(table, missing_key));
+  ck_assert_int_eq(false,
+                   get_key_value_pair_from_hash_table(table, missing_key, &pair));
+  destroy_string(missing_key);
+
+  destroy_string(key);
+  // Destroy the hash table
+  destruct_hash_table(table);
+}
+END_TEST
+
 Suite *create_test_suite_hash_table_str_key_int_value(void) {
   Suite *suite = suite_create("StringKeyIntValueTests");
 
@@ -348,6 +601,7 @@ Suite *create_test_suite_hash_table_str_key_int_value(void) {
   TCase *tc_get_from_hash_table = tcase_create("GetFromHashTable");
   tcase_add_test(tc_get_from_hash_table, test_get_from_hash_table);
   tcase_add_test(tc_get_from_hash_table, test_get_from_hash_table_non_existing_key);
+  tcase_add_test(tc_get_from_hash_table, test_borrowed_lookups_do_not_copy);
   suite_add_tcase(suite, tc_get_from_hash_table);
 
   TCase *tc_remove_from_hash_table = tcase_create("RemoveFromHashTable");
@@ -360,5 +614,17 @@ Suite *create_test_suite_hash_table_str_key_int_value(void) {
   tcase_add_test(tc_contains_key, test_contains_key_2_keys);
   suite_add_tcase(suite, tc_contains_key);
 
+  TCase *tc_probing = tcase_create("Probing");
+  tcase_add_test(tc_probing, test_robin_hood_keeps_existing_entries);
+  tcase_add_test(tc_probing, test_incremental_resize_destruct_during_migration);
+  tcase_add_test(tc_probing, test_resize_does_not_copy_keys);
+  tcase_add_test(tc_probing, test_resize_does_not_hash_keys_again);
+  tcase_add_test(tc_probing, test_export_copies_keys);
+  suite_add_tcase(suite, tc_probing);
+
+  TCase *tc_upsert = tcase_create("UpsertInHashTable");
+  tcase_add_test(tc_upsert, test_update_in_hash_table_with_counts_words);
+  suite_add_tcase(suite, tc_upsert);
+
   return suite;
 }
@@ -1,5 +1,11 @@
 #include "linked_list/linked_list_tests.h"
 #include "hash_table/hash_table_tests.h"
+#include "concurrent_hash_table/concurrent_hash_table_tests.h"
+#include "ordered_hash_table/ordered_hash_table_tests.h"
+#include "hash_set/hash_set_tests.h"
+#include "multi_map/multi_map_tests.h"
+#include "typed_hash_table/typed_hash_table_tests.h"
+#include "bloom_filter/bloom_filter_tests.h"
 #include <check.h>
 
 #include <check.h>
@@ -12,6 +18,15 @@ int main(void) {
   srunner_add_suite(runner, create_test_suite_linked_list_string_t());
   srunner_add_suite(runner, create_test_suite_hash_table_int_key_float_value());
   srunner_add_suite(runner, create_test_suite_hash_table_str_key_int_value());
+  srunner_add_suite(runner,
+                    create_test_suite_concurrent_hash_table_int_key_int_value());
+  srunner_add_suite(runner,
+                    create_test_suite_read_mostly_hash_table_int_key_int_value());
+  srunner_add_suite(runner, create_test_suite_ordered_hash_table());
+  srunner_add_suite(runner, create_test_suite_hash_set());
+  srunner_add_suite(runner, create_test_suite_multi_map());
+  srunner_add_suite(runner, create_test_suite_typed_hash_table());
+  srunner_add_suite(runner, create_test_suite_bloom_filter());
 
 
 
@@ -0,0 +1,110 @@
+#include "../types/int/int.h"
+#include "../types/user_type_string/string.h"
+#include "multi_map_tests.h"
+
+#include <stdio.h>
+
+START_TEST(test_multi_map_groups_values) {
+  multi_map_t *map = create_multi_map(sizeof(int), NULL, NULL,
+                                      (compare_t)compare_ints, sizeof(int),
+                                      NULL, NULL, (compare_t)compare_ints);
+  ck_assert_ptr_nonnull(map);
+
+  // Group events by user, with users interleaved
+  for (int event = 0; event < 10000; event++) {
+    int user = event % 100;
+    ck_assert_int_eq(true, add_to_multi_map(map, &user, &event));
+  }
+  ck_assert_uint_eq(map->table->count, 100);
+
+  for (int user = 0; user < 100; user++) {
+    size_t count = 0;
+    const int *events = get_values_from_multi_map(map, &user, &count);
+    ck_assert_ptr_nonnull(events);
+    ck_assert_uint_eq(count, 100);
+    for (size_t i = 0; i < count; i++) {
+      ck_assert_int_eq(events[i], user + (int)i * 100);
+    }
+  }
+
+  int user = 7;
+  ck_assert_int_eq(true, remove_from_multi_map(map, &user));
+  ck_assert_int_eq(false, contains_key_in_multi_map(map, &user));
+  size_t count = 1;
+  ck_assert_ptr_null(get_values_from_multi_map(map, &user, &count));
+  ck_assert_uint_eq(count, 0);
+  ck_assert_int_eq(false, remove_from_multi_map(map, &user));
+
+  destruct_multi_map(map);
+}
+END_TEST
+
+START_TEST(test_multi_map_string_keys) {
+  multi_map_t *map = create_multi_map(
+      sizeof(string_t), (copy_t)copy_string, (destruct_t)destroy_string,
+      (compare_t)compare_strings, sizeof(int), NULL, NULL,
+      (compare_t)compare_ints);
+  ck_assert_ptr_nonnull(map);
+  map->table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+
+  char buffer[32];
+  for (int i = 0; i < 300; i++) {
+    snprintf(buffer, sizeof(buffer), "user_%d", i % 3);
+    string_t *key = create_string(buffer);
+    ck_assert_int_eq(true, add_to_multi_map(map, key, &i));
+    destroy_string(key);
+  }
+
+  string_t *key = create_string("user_2");
+  size_t count = 0;
+  const int *values = get_values_from_multi_map(map, key, &count);
+  ck_assert_uint_eq(count, 100);
+  ck_assert_int_eq(values[0], 2);
+  ck_assert_int_eq(values[99], 299);
+  ck_assert_int_eq(true, remove_from_multi_map(map, key));
+  destroy_string(key);
+
+  destruct_multi_map(map);
+}
+END_TEST
+
+START_TEST(test_multi_map_string_values) {
+  multi_map_t *map = create_multi_map(
+      sizeof(int), NULL, NULL, (compare_t)compare_ints, sizeof(string_t),
+      (copy_t)copy_string, (destruct_t)destroy_string_contents,
+      (compare_t)compare_strings);
+  ck_assert_ptr_nonnull(map);
+
+  // Values are deep copies, released on removal and on destruction
+  char buffer[32];
+  for (int i = 0; i < 300; i++) {
+    int user = i % 3;
+    snprintf(buffer, sizeof(buffer), "event_%d", i);
+    string_t *value = create_string(buffer);
+    ck_assert_int_eq(true, add_to_multi_map(map, &user, value));
+    destroy_string(value);
+  }
+
+  int user = 1;
+  size_t count = 0;
+  const string_t *values = get_values_from_multi_map(map, &user, &count);
+  ck_assert_uint_eq(count, 100);
+  ck_assert_str_eq(values[0].string, "event_1");
+  ck_assert_str_eq(values[99].string, "event_298");
+  ck_assert_int_eq(true, remove_from_multi_map(map, &user));
+
+  destruct_multi_map(map);
+}
+END_TEST
+
+Suite *create_test_suite_multi_map(void) {
+  Suite *suite = suite_create("Multi-Map Tests");
+
+  TCase *tcase_base = tcase_create("Base functions of Multi-Map");
+  tcase_add_test(tcase_base, test_multi_map_groups_values);
+  tcase_add_test(tcase_base, test_multi_map_string_keys);
+  tcase_add_test(tcase_base, test_multi_map_string_values);
+  suite_add_tcase(suite, tcase_base);
+
+  return suite;
+}
@@ -0,0 +1,8 @@
+#ifndef MULTI_MAP_TESTS_H
+#define MULTI_MAP_TESTS_H
+
+#include "../../src/multi_map/multi_map.h"
+#include <check.h>
+Suite *create_test_suite_multi_map(void);
+
+#endif
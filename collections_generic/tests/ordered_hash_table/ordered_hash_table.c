@@ -0,0 +1,149 @@
+#include "../../src/ordered_hash_table/ordered_hash_table_functions/common/ordered_entries.h"
+#include "../types/int/int.h"
+#include "../types/user_type_string/string.h"
+#include "ordered_hash_table_tests.h"
+
+#include <stdio.h>
+
+START_TEST(test_ordered_hash_table_base_functions) {
+  ordered_hash_table_t *table = create_ordered_hash_table(
+      sizeof(int), NULL, NULL, (compare_t)compare_ints, sizeof(int), NULL, NULL,
+      NULL);
+  ck_assert_ptr_nonnull(table);
+  ck_assert_int_eq(table->storage, FLAT_STORAGE);
+
+  int key = 42;
+  int value = 1;
+  ck_assert_int_eq(true, add_to_ordered_hash_table(table, &key, &value));
+  ck_assert_int_eq(false, add_to_ordered_hash_table(table, &key, &value));
+  ck_assert_int_eq(true, contains_key_in_ordered_hash_table(table, &key));
+
+  value = 2;
+  ck_assert_int_eq(true, change_in_ordered_hash_table(table, &key, &value));
+  value = 0;
+  ck_assert_int_eq(true, get_from_ordered_hash_table(table, &key, &value));
+  ck_assert_int_eq(value, 2);
+
+  ck_assert_int_eq(true, remove_from_ordered_hash_table(table, &key));
+  ck_assert_int_eq(false, remove_from_ordered_hash_table(table, &key));
+  ck_assert_int_eq(false, get_from_ordered_hash_table(table, &key, &value));
+  ck_assert_uint_eq(table->count, 0);
+
+  destruct_ordered_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_ordered_hash_table_keeps_insertion_order) {
+  ordered_hash_table_t *table = create_ordered_hash_table(
+      sizeof(int), NULL, NULL, (compare_t)compare_ints, sizeof(int), NULL, NULL,
+      NULL);
+  ck_assert_ptr_nonnull(table);
+
+  // Keys in an order unrelated to their hashes, enough to resize
+  for (int i = 0; i < 5000; i++) {
+    int key = (i * 7919) % 5000;
+    ck_assert_int_eq(true, add_to_ordered_hash_table(table, &key, &i));
+  }
+  // Remove every third key, then add them back at the end
+  for (int i = 0; i < 5000; i += 3) {
+    int key = (i * 7919) % 5000;
+    ck_assert_int_eq(true, remove_from_ordered_hash_table(table, &key));
+  }
+  for (int i = 0; i < 5000; i += 3) {
+    int key = (i * 7919) % 5000;
+    int value = 5000 + i;
+    ck_assert_int_eq(true, add_to_ordered_hash_table(table, &key, &value));
+  }
+  ck_assert_uint_eq(table->count, 5000);
+
+  // Values were assigned in insertion order, so they come out increasing
+  size_t position = 0;
+  key_value_pair_t pair;
+  int previous = -1;
+  size_t visited = 0;
+  while (next_in_ordered_hash_table(table, &position, &pair)) {
+    int value = *(int *)pair.value;
+    ck_assert_int_gt(value, previous);
+    ck_assert_int_eq(*(int *)pair.key, (value % 5000 * 7919) % 5000);
+    previous = value;
+    visited++;
+  }
+  ck_assert_uint_eq(visited, 5000);
+
+  destruct_ordered_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_ordered_hash_table_string_keys) {
+  ordered_hash_table_t *table = create_ordered_hash_table(
+      sizeof(string_t), (copy_t)copy_string, (destruct_t)destroy_string,
+      (compare_t)compare_strings, sizeof(int), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(table);
+  ck_assert_int_eq(table->storage, NODE_STORAGE);
+  table->get_hash_code = (get_hash_code_t)get_hash_code_string;
+
+  char buffer[32];
+  for (int i = 0; i < 100; i++) {
+    snprintf(buffer, sizeof(buffer), "key_%d", i);
+    string_t *key = create_string(buffer);
+    ck_assert_int_eq(true, add_to_ordered_hash_table(table, key, &i));
+    if (i % 2 == 1)
+      ck_assert_int_eq(true, remove_from_ordered_hash_table(table, key));
+    destroy_string(key);
+  }
+
+  size_t position = 0;
+  key_value_pair_t pair;
+  for (int i = 0; i < 100; i += 2) {
+    ck_assert_int_eq(true, next_in_ordered_hash_table(table, &position, &pair));
+    snprintf(buffer, sizeof(buffer), "key_%d", i);
+    string_t *key = create_string(buffer);
+    ck_assert_int_eq(compare_strings(pair.key, key), 0);
+    ck_assert_int_eq(*(int *)pair.value, i);
+    destroy_string(key);
+  }
+  ck_assert_int_eq(false, next_in_ordered_hash_table(table, &position, &pair));
+
+  destruct_ordered_hash_table(table);
+}
+END_TEST
+
+START_TEST(test_ordered_hash_table_index_limit) {
+  ordered_hash_table_t *table = create_ordered_hash_table(
+      sizeof(int), NULL, NULL, (compare_t)compare_ints, sizeof(int), NULL, NULL,
+      NULL);
+  ck_assert_ptr_nonnull(table);
+
+  for (int key = 0; key < 100; key++) {
+    ck_assert_int_eq(true, add_to_ordered_hash_table(table, &key, &key));
+  }
+  size_t index_capacity = table->index_capacity;
+
+  // Entry offsets past ORDERED_INDEX_DELETED would read as markers
+  ck_assert_int_eq(false, rebuild_ordered_entries(table, (size_t)1 << 33));
+  ck_assert_uint_eq(table->index_capacity, index_capacity);
+  for (int key = 0; key < 100; key++) {
+    int value = -1;
+    ck_assert_int_eq(true, get_from_ordered_hash_table(table, &key, &value));
+    ck_assert_int_eq(value, key);
+  }
+
+  destruct_ordered_hash_table(table);
+}
+END_TEST
+
+Suite *create_test_suite_ordered_hash_table(void) {
+  Suite *suite = suite_create("Ordered Hash Table Tests");
+
+  TCase *tcase_base = tcase_create("Base functions of Ordered Hash Table");
+  tcase_add_test(tcase_base, test_ordered_hash_table_base_functions);
+  tcase_add_test(tcase_base, test_ordered_hash_table_index_limit);
+  suite_add_tcase(suite, tcase_base);
+
+  TCase *tcase_order = tcase_create("Order in Ordered Hash Table");
+  tcase_add_test(tcase_order, test_ordered_hash_table_keeps_insertion_order);
+  tcase_add_test(tcase_order, test_ordered_hash_table_string_keys);
+  suite_add_tcase(suite, tcase_order);
+
+  return suite;
+}
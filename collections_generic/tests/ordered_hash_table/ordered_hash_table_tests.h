@@ -0,0 +1,8 @@
+#ifndef ORDERED_HASH_TABLE_TESTS_H
+#define ORDERED_HASH_TABLE_TESTS_H
+
+#include "../../src/ordered_hash_table/ordered_hash_table.h"
+#include <check.h>
+Suite *create_test_suite_ordered_hash_table(void);
+
+#endif
@@ -0,0 +1,85 @@
+#include "../../src/hash_table/hash_table.h"
+#include "../types/int/int.h"
+#include "typed_hash_table_tests.h"
+
+#define ACCURACY 1e-6
+
+static inline size_t hash_int(int key) { return (size_t)(unsigned int)key; }
+#define EQUAL_INTS(first, second) ((first) == (second))
+
+DECLARE_HASH_TABLE(int_float_map, int, float, hash_int, EQUAL_INTS);
+
+START_TEST(test_typed_hash_table_base_functions) {
+  int_float_map_t *map = int_float_map_create();
+  ck_assert_ptr_nonnull(map);
+
+  ck_assert_int_eq(true, int_float_map_add(map, 42, -420.2f));
+  ck_assert_int_eq(false, int_float_map_add(map, 42, 1.0f));
+  ck_assert_int_eq(true, int_float_map_contains(map, 42));
+  ck_assert_int_eq(false, int_float_map_contains(map, 43));
+
+  float value;
+  ck_assert_int_eq(true, int_float_map_get(map, 42, &value));
+  ck_assert_float_eq_tol(value, -420.2f, ACCURACY);
+  ck_assert_int_eq(true, int_float_map_change(map, 42, 3.5f));
+  ck_assert_int_eq(false, int_float_map_change(map, 43, 3.5f));
+  ck_assert_float_eq_tol(*int_float_map_get_pointer(map, 42), 3.5f, ACCURACY);
+
+  ck_assert_int_eq(true, int_float_map_remove(map, 42));
+  ck_assert_int_eq(false, int_float_map_remove(map, 42));
+  ck_assert_int_eq(false, int_float_map_get(map, 42, &value));
+  ck_assert_uint_eq(map->count, 0);
+
+  int_float_map_destruct(map);
+}
+END_TEST
+
+START_TEST(test_typed_hash_table_matches_hash_table) {
+  int_float_map_t *map = int_float_map_create();
+  hash_table_t *table =
+      create_hash_table(sizeof(int), NULL, NULL, (compare_t)compare_ints,
+                        sizeof(float), NULL, NULL, NULL);
+  ck_assert_ptr_nonnull(map);
+  ck_assert_ptr_nonnull(table);
+
+  // the same random churn gives the same answers in both tables
+  unsigned int state = 12345;
+  for (int step = 0; step < 200000; step++) {
+    state = state * 1103515245u + 12345u;
+    int key = (int)((state >> 8) % 5000);
+    float value = (float)step;
+    switch ((state >> 4) % 4) {
+    case 0:
+    case 1:
+      ck_assert_int_eq(add_to_hash_table(table, &key, &value),
+                       int_float_map_add(map, key, value));
+      break;
+    case 2:
+      ck_assert_int_eq(remove_from_hash_table(table, &key),
+                       int_float_map_remove(map, key));
+      break;
+    default: {
+      float expected = 0, retrieved = 0;
+      ck_assert_int_eq(get_from_hash_table(table, &key, &expected),
+                       int_float_map_get(map, key, &retrieved));
+      ck_assert_float_eq_tol(retrieved, expected, ACCURACY);
+    }
+    }
+    ck_assert_uint_eq(map->count, table->count);
+  }
+
+  destruct_hash_table(table);
+  int_float_map_destruct(map);
+}
+END_TEST
+
+Suite *create_test_suite_typed_hash_table(void) {
+  Suite *suite = suite_create("Typed Hash Table Tests");
+
+  TCase *tcase_base = tcase_create("Typed Hash Table base functions");
+  tcase_add_test(tcase_base, test_typed_hash_table_base_functions);
+  tcase_add_test(tcase_base, test_typed_hash_table_matches_hash_table);
+  suite_add_tcase(suite, tcase_base);
+
+  return suite;
+}
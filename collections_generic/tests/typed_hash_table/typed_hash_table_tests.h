@@ -0,0 +1,8 @@
+#ifndef TYPED_HASH_TABLE_TESTS_H
+#define TYPED_HASH_TABLE_TESTS_H
+
+#include "../../src/typed_hash_table/typed_hash_table.h"
+#include <check.h>
+Suite *create_test_suite_typed_hash_table(void);
+
+#endif
@@ -18,6 +18,13 @@ void destroy_string(string_t *string) {
   free(string);
 }
 
+void destroy_string_contents(string_t *string) {
+  if (string == NULL)
+    return;
+  free(string->string);
+  string->string = NULL;
+}
+
 void copy_string(const string_t *src, string_t *dest) {
   if (dest == NULL || src == NULL)
     return;
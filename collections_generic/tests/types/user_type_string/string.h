@@ -9,6 +9,7 @@ typedef struct string_t {
 
 string_t *create_string(const char *string);
 void destroy_string(string_t *string);
+void destroy_string_contents(string_t *string);
 void copy_string(const string_t *src, string_t *dest);
 int compare_strings(const string_t *a, const string_t *b);
 
@@ -1,4 +1,5 @@
 #include "../../string.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -108,12 +109,32 @@ void copy_string(const string_t *src, string_t *dest) {
   memcpy(dest->string, src->string, src->size);
 }
 
+static uint64_t mix_string_word(uint64_t hash, uint64_t word)
+{
+  hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+  return hash ^ (hash >> 32);
+}
+
 size_t get_hash_code_string(size_t capacity, size_t key_gen, const string_t* key)
 {
   size_t key_size = key->size - 1;
-  size_t hash = 0;
-  for (size_t i = 0; i < key_size; i++)
-    hash = (hash * key_gen + key->string[i]) % capacity;
-  hash = (hash * 2 + 1) % capacity;
-  return hash; 
+  const char *bytes = key->string;
+  uint64_t hash = (uint64_t)key_gen ^ ((uint64_t)key_size * 0xff51afd7ed558ccdULL);
+  uint64_t word;
+
+  // consume the string eight bytes at a time, the modulo is taken only once
+  for (; key_size >= sizeof(word); key_size -= sizeof(word), bytes += sizeof(word)) {
+    memcpy(&word, bytes, sizeof(word));
+    hash = mix_string_word(hash, word);
+  }
+  if (key_size > 0) {
+    word = 0;
+    memcpy(&word, bytes, key_size);
+    hash = mix_string_word(hash, word);
+  }
+
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb3fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return (size_t)(hash % capacity);
 }
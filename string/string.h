@@ -139,8 +139,11 @@ void copy_string(const string_t *src, string_t *dest);
 /**
  * @brief Calculates the hash code for a string.
  *
+ * The string is hashed eight bytes at a time into a 64-bit value, which is
+ * reduced to `capacity` only at the end.
+ *
  * @param capacity The capacity of the hash table.
- * @param key_gen The key generation factor.
+ * @param key_gen The seed of the hash.
  * @param key Pointer to the string key.
  * @return The calculated hash code.
  */